@@ -429,7 +429,9 @@ typedef struct GlobalContext {
     /* 0x5C78 */ CollisionCheckContext colChkCtx;
     //TODO
 } GlobalContext; // size = 0x5F14 TODO
+#ifdef _3DS // the host tests see other pointer sizes
 _Static_assert(sizeof(GlobalContext) == 0x5F14, "Global Context size");
+#endif
 
 typedef struct StaticContext {
     /* 0x0000 */ char unk_0[0x0E72];
@@ -37,6 +37,114 @@
 
 static u8* FRAMEBUFFER[6];
 
+// Part of a screen in pixels, empty when left >= right. The screens are stored sideways,
+// so a range of columns is also one range of bytes in the framebuffer.
+typedef struct {
+    u32 left, right;  // columns, right is exclusive
+    u32 top, bottom;  // rows, bottom is exclusive
+} DrawRect;
+
+typedef struct {
+    u8 **framebuffers;
+    u32 framebufferCount;
+    u32 width;
+    u32 height;
+    DrawRect drawn;     // everything drawn since the last clear
+    DrawRect unflushed; // everything changed since the last cache flush
+} DrawScreen;
+
+static DrawScreen bottomScreen = { &FRAMEBUFFER[0], 2, SCREEN_BOT_WIDTH, SCREEN_BOT_HEIGHT };
+static DrawScreen topScreen    = { &FRAMEBUFFER[2], 4, SCREEN_TOP_WIDTH, SCREEN_TOP_HEIGHT };
+
+static bool Draw_RectIsEmpty(const DrawRect *rect)
+{
+    return rect->left >= rect->right;
+}
+
+static void Draw_AddToRect(DrawRect *rect, const DrawRect *area)
+{
+    if(Draw_RectIsEmpty(area))
+        return;
+
+    if(Draw_RectIsEmpty(rect))
+    {
+        *rect = *area;
+        return;
+    }
+
+    if(area->left < rect->left)     rect->left = area->left;
+    if(area->right > rect->right)   rect->right = area->right;
+    if(area->top < rect->top)       rect->top = area->top;
+    if(area->bottom > rect->bottom) rect->bottom = area->bottom;
+}
+
+static void Draw_MarkDirty(DrawScreen *screen, u32 left, u32 top, u32 right, u32 bottom)
+{
+    DrawRect area = {
+        left,
+        (right < screen->width) ? right : screen->width,
+        top,
+        (bottom < screen->height) ? bottom : screen->height,
+    };
+    if(area.top >= area.bottom)
+        return;
+
+    Draw_AddToRect(&screen->drawn, &area);
+    Draw_AddToRect(&screen->unflushed, &area);
+}
+
+// Nothing is known about what the game left on the screens, so they start fully dirty
+static void Draw_MarkAllDirty(DrawScreen *screen)
+{
+    const DrawRect full = { 0, screen->width, 0, screen->height };
+    screen->drawn = full;
+    screen->unflushed = full;
+}
+
+// Clears only what was drawn since the last clear
+static void Draw_ClearScreen(DrawScreen *screen)
+{
+    const DrawRect *rect = &screen->drawn;
+    if(Draw_RectIsEmpty(rect))
+        return;
+
+    const u32 columnSize = screen->height * 3;
+    for(u32 fb = 0; fb < screen->framebufferCount; fb++)
+    {
+        u8 *columns = screen->framebuffers[fb] + rect->left * columnSize;
+
+        if(rect->top == 0 && rect->bottom == screen->height)
+        {
+            memset(columns, 0, (rect->right - rect->left) * columnSize);
+            continue;
+        }
+
+        // Rows are stored bottom to top within a column
+        const u32 rowsStart = (screen->height - rect->bottom) * 3;
+        const u32 rowsSize = (rect->bottom - rect->top) * 3;
+        for(u32 x = rect->left; x < rect->right; x++, columns += columnSize)
+            memset(columns + rowsStart, 0, rowsSize);
+    }
+
+    Draw_AddToRect(&screen->unflushed, rect);
+    screen->drawn = (DrawRect){ 0 };
+}
+
+// Flushes the columns changed since the last flush
+static void Draw_FlushScreen(DrawScreen *screen)
+{
+    const DrawRect *rect = &screen->unflushed;
+    if(Draw_RectIsEmpty(rect))
+        return;
+
+    const u32 columnSize = screen->height * 3;
+    for(u32 fb = 0; fb < screen->framebufferCount; fb++)
+        svcFlushProcessDataCache(CUR_PROCESS_HANDLE, screen->framebuffers[fb] + rect->left * columnSize,
+                                 (rect->right - rect->left) * columnSize);
+
+    screen->unflushed = (DrawRect){ 0 };
+}
+
 static RecursiveLock lock;
 
 void Draw_Lock(void)
@@ -56,65 +164,75 @@ void Draw_Unlock(void)
     RecursiveLock_Unlock(&lock);
 }
 
-void Draw_DrawCharacter(u32 posX, u32 posY, u32 color, char character)
-{
-    volatile u8 *const fb0 = (volatile u8 *const)FRAMEBUFFER[0];
-    volatile u8 *const fb1 = (volatile u8 *const)FRAMEBUFFER[1];
+// The font pre-rotated into framebuffer order. The screens are stored sideways, so each
+// column of a character is FONT_HEIGHT pixels in a row in memory, bottom pixel first.
+// Bit i of a strip is the pixel at offset i of that column, which is glyph row FONT_HEIGHT - 1 - i.
+static u16 glyphStrips[256][FONT_WIDTH];
 
-    for(s32 y = 0; y < 10; y++)
+static void Draw_ExpandFont(void)
+{
+    for(u32 character = 0; character < 256; character++)
     {
-        const char charPos = ascii_font[character * 10 + y];
-
-        for(s32 x = 6; x >= 1; x--)
+        for(u32 column = 0; column < FONT_WIDTH; column++)
         {
-            const u32 screenPos = (posX * SCREEN_BOT_HEIGHT + (SCREEN_BOT_HEIGHT - y - posY - 1)) + (5 - x) * SCREEN_BOT_HEIGHT;
-            const u32 pixelColor = ((charPos >> x) & 1) ? color : COLOR_BLACK;
-
-            fb0[screenPos * 3] = (pixelColor) & 0xFF;
-            fb0[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
-            fb0[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
-            fb1[screenPos * 3] = (pixelColor) & 0xFF;
-            fb1[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
-            fb1[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
+            u16 strip = 0;
+            for(u32 y = 0; y < FONT_HEIGHT; y++)
+            {
+                // Glyph rows use bits 6 to 1, left to right
+                if((ascii_font[character * FONT_HEIGHT + y] >> (FONT_WIDTH - column)) & 1)
+                    strip |= 1 << (FONT_HEIGHT - 1 - y);
+            }
+            glyphStrips[character][column] = strip;
         }
     }
 }
 
-void Draw_DrawCharacterTop(u32 posX, u32 posY, u32 color, char character)
+// Builds each column of the character once, then copies it to every framebuffer of the screen
+static void Draw_BlitCharacter(DrawScreen *screen, u32 posX, u32 posY, u32 color, char character)
 {
-    volatile u8 *const fb2 = (volatile u8 *const)FRAMEBUFFER[2];
-    volatile u8 *const fb3 = (volatile u8 *const)FRAMEBUFFER[3];
-    volatile u8 *const fb4 = (volatile u8 *const)FRAMEBUFFER[4];
-    volatile u8 *const fb5 = (volatile u8 *const)FRAMEBUFFER[5];
-
-    for(s32 y = 0; y < 10; y++)
+    u8 *const *framebuffers = screen->framebuffers;
+    const u32 screenHeight = screen->height;
+    const u16 *strips = glyphStrips[(u8)character];
+    const u8 foreground[3] = { color & 0xFF, (color >> 8) & 0xFF, (color >> 16) & 0xFF };
+    const u8 background[3] = { COLOR_BLACK & 0xFF, (COLOR_BLACK >> 8) & 0xFF, (COLOR_BLACK >> 16) & 0xFF };
+    const u32 stripStart = screenHeight - posY - FONT_HEIGHT;
+    u8 column[FONT_HEIGHT * 3];
+
+    for(u32 x = 0; x < FONT_WIDTH; x++)
     {
-        const char charPos = ascii_font[character * 10 + y];
+        // The first font column lands one pixel left of posX, skip it at the screen edge
+        if(posX + x < 1)
+            continue;
 
-        for(s32 x = 6; x >= 1; x--)
+        for(u32 i = 0; i < FONT_HEIGHT; i++)
         {
-            const u32 screenPos = (posX * SCREEN_TOP_HEIGHT + (SCREEN_TOP_HEIGHT - y - posY - 1)) + (5 - x) * SCREEN_TOP_HEIGHT;
-            const u32 pixelColor = ((charPos >> x) & 1) ? color : COLOR_BLACK;
-
-            fb2[screenPos * 3] = (pixelColor) & 0xFF;
-            fb2[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
-            fb2[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
-            fb3[screenPos * 3] = (pixelColor) & 0xFF;
-            fb3[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
-            fb3[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
-            fb4[screenPos * 3] = (pixelColor) & 0xFF;
-            fb4[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
-            fb4[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
-            fb5[screenPos * 3] = (pixelColor) & 0xFF;
-            fb5[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
-            fb5[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
+            const u8 *pixel = ((strips[x] >> i) & 1) ? foreground : background;
+            column[i * 3] = pixel[0];
+            column[i * 3 + 1] = pixel[1];
+            column[i * 3 + 2] = pixel[2];
         }
+
+        const u32 offset = ((posX + x - 1) * screenHeight + stripStart) * 3;
+        for(u32 fb = 0; fb < screen->framebufferCount; fb++)
+            memcpy(framebuffers[fb] + offset, column, sizeof(column));
     }
+
+    Draw_MarkDirty(screen, (posX > 0) ? posX - 1 : 0, posY, posX + FONT_WIDTH - 1, posY + FONT_HEIGHT);
+}
+
+void Draw_DrawCharacter(u32 posX, u32 posY, u32 color, char character)
+{
+    Draw_BlitCharacter(&bottomScreen, posX, posY, color, character);
+}
+
+void Draw_DrawCharacterTop(u32 posX, u32 posY, u32 color, char character)
+{
+    Draw_BlitCharacter(&topScreen, posX, posY, color, character);
 }
 
 u32 Draw_DrawString(u32 posX, u32 posY, u32 color, const char *string)
 {
-    for(u32 i = 0, line_i = 0; i < strlen(string); i++)
+    for(u32 i = 0, line_i = 0; string[i] != '\0'; i++)
         switch(string[i])
         {
             case '\n':
@@ -146,7 +264,7 @@ u32 Draw_DrawString(u32 posX, u32 posY, u32 color, const char *string)
 
 u32 Draw_DrawStringTop(u32 posX, u32 posY, u32 color, const char *string)
 {
-    for(u32 i = 0, line_i = 0; i < strlen(string); i++)
+    for(u32 i = 0, line_i = 0; string[i] != '\0'; i++)
         switch(string[i])
         {
             case '\n':
@@ -204,11 +322,15 @@ void Draw_FillFramebuffer(u32 value)
 {
     memset(FRAMEBUFFER[0], value, FB_BOTTOM_SIZE);
     memset(FRAMEBUFFER[1], value, FB_BOTTOM_SIZE);
+
+    Draw_MarkAllDirty(&bottomScreen);
+    if(value == 0)
+        bottomScreen.drawn = (DrawRect){ 0 };
 }
 
 void Draw_ClearFramebuffer(void)
 {
-    Draw_FillFramebuffer(0);
+    Draw_ClearScreen(&bottomScreen);
 }
 
 void Draw_SetupFramebuffer(void)
@@ -219,18 +341,23 @@ void Draw_SetupFramebuffer(void)
     FRAMEBUFFER[3] = (u8*)Z3D_TOP_SCREEN_LEFT_2;
     FRAMEBUFFER[4] = (u8*)Z3D_TOP_SCREEN_RIGHT_1;
     FRAMEBUFFER[5] = (u8*)Z3D_TOP_SCREEN_RIGHT_2;
+    Draw_MarkAllDirty(&bottomScreen);
+    Draw_MarkAllDirty(&topScreen);
+
+    static bool fontExpanded = false;
+    if(!fontExpanded)
+    {
+        Draw_ExpandFont();
+        fontExpanded = true;
+    }
 }
 
 void Draw_FlushFramebuffer(void)
 {
-    svcFlushProcessDataCache(CUR_PROCESS_HANDLE, FRAMEBUFFER[0], FB_BOTTOM_SIZE);
-    svcFlushProcessDataCache(CUR_PROCESS_HANDLE, FRAMEBUFFER[1], FB_BOTTOM_SIZE);
+    Draw_FlushScreen(&bottomScreen);
 }
 
 void Draw_FlushFramebufferTop(void)
 {
-    svcFlushProcessDataCache(CUR_PROCESS_HANDLE, FRAMEBUFFER[2], FB_TOP_SIZE);
-    svcFlushProcessDataCache(CUR_PROCESS_HANDLE, FRAMEBUFFER[3], FB_TOP_SIZE);
-    svcFlushProcessDataCache(CUR_PROCESS_HANDLE, FRAMEBUFFER[4], FB_TOP_SIZE);
-    svcFlushProcessDataCache(CUR_PROCESS_HANDLE, FRAMEBUFFER[5], FB_TOP_SIZE);
+    Draw_FlushScreen(&topScreen);
 }
\ No newline at end of file
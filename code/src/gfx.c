@@ -9,6 +9,10 @@
 #include "objects.h"
 #include "title_screen.h"
 #include "settings.h"
+#include "models.h"
+#include "item_override.h"
+#include "profiler.h"
+#include "3ds/os.h"
 
 static u8 GfxInit = 0;
 static u32 closingButton = 0;
@@ -54,17 +58,63 @@ static void Gfx_DrawDungeonRewards(void) {
     Draw_FlushFramebuffer();
 }
 
+static void Gfx_DrawMemoryUsage(void) {
+    ModelPoolStats modelStats;
+    rHeapStats heapStats;
+    PendingOverrideStats pendingStats;
+    Model_GetPoolStats(&modelStats);
+    rHeap_GetStats(&heapStats);
+    ItemOverride_GetPendingStats(&pendingStats);
+
+    Draw_DrawFormattedString(10, 10, COLOR_TITLE, "Memory Usage:");
+    Draw_DrawFormattedString(10, 10 + SPACING_Y, COLOR_WHITE, "    Models: %d/%d active, peak %d, dropped %d",
+        modelStats.active, modelStats.capacity, modelStats.highWater, modelStats.overflows);
+    Draw_DrawFormattedString(10, 10 + 2 * SPACING_Y, COLOR_WHITE, "    Heap: %d/%d bytes at init, %d overflows, %d bad frees",
+        heapStats.bumpUsed, heapStats.bumpSize, heapStats.overflows, heapStats.badFrees);
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        Draw_DrawFormattedString(10, 10 + (3 + c) * SPACING_Y, COLOR_WHITE, "    %3d byte blocks: %d/%d used, peak %d",
+            heapStats.classBlockSize[c], heapStats.classUsed[c], heapStats.classCapacity[c], heapStats.classPeak[c]);
+    }
+    Draw_DrawFormattedString(10, 10 + (3 + RHEAP_SMALL_CLASSES) * SPACING_Y, COLOR_WHITE, "    Pending items: %d/%d queued, peak %d, %d waiting, dropped %d",
+        pendingStats.queued, pendingStats.capacity, pendingStats.highWater, pendingStats.waiting, pendingStats.overflows);
+    Gfx_DrawChangeMenuPrompt();
+    Draw_FlushFramebuffer();
+}
+
+#ifdef ENABLE_PROFILER
+static void Gfx_DrawProfiler(void) {
+    Draw_DrawFormattedString(10, 10, COLOR_TITLE, "Hook Timings (us, last %d calls):", PROFILE_WINDOW);
+    Draw_DrawFormattedString(10, 10 + SPACING_Y, COLOR_TITLE, "    %-25s %6s %6s %6s", "", "min", "avg", "max");
+    for (u32 section = 0; section < PROFILE_MAX; ++section) {
+        ProfileSummary summary;
+        Profile_GetSummary(section, &summary);
+        Draw_DrawFormattedString(10, 10 + (2 + section) * SPACING_Y, COLOR_WHITE, "    %-25s %6d %6d %6d",
+            ProfileSectionNames[section],
+            (u32)(summary.min / CPU_TICKS_PER_USEC),
+            (u32)(summary.avg / CPU_TICKS_PER_USEC),
+            (u32)(summary.max / CPU_TICKS_PER_USEC));
+    }
+    Gfx_DrawChangeMenuPrompt();
+    Draw_FlushFramebuffer();
+}
+#endif
+
 static const void (*menu_draw_funcs[])(void) = {
     Gfx_DrawSeedHash,
     Gfx_DrawDungeonItems,
     Gfx_DrawDungeonRewards,
+    Gfx_DrawMemoryUsage,
+#ifdef ENABLE_PROFILER
+    Gfx_DrawProfiler,
+#endif
 };
 
 static void Gfx_ShowMenu(void) {
     static s32 curMenuIdx = 0;
     u32 pressed = 0;
 
-    Draw_ClearFramebuffer();
+    //the game's own image is still on the screen, so black out all of it once
+    Draw_FillFramebuffer(0);
     Draw_FlushFramebuffer();
 
     do {
@@ -5,6 +5,8 @@
 #include "settings.h"
 #include "custom_models.h"
 #include "objects.h"
+#include "profiler.h"
+#include "override_table.h"
 #include <stddef.h>
 void svcBreak(u32 breakReason); //TODO: remove
 
@@ -12,10 +14,22 @@ void svcBreak(u32 breakReason); //TODO: remove
 #include "z3D/actors/z_en_box.h"
 #include "z3D/actors/z_en_item00.h"
 
-static ItemOverride rItemOverrides[512] = { 0 };
-static s32 rItemOverrides_Count = 0;
-
-static ItemOverride rPendingOverrideQueue[3] = { 0 };
+// Filled in by the app, see override_table.h for the layout
+static OverrideTable rItemOverrides = { 0 };
+
+// Ring buffer of items waiting to be given, head and tail run freely and are masked on access
+static ItemOverride rPendingOverrideQueue[PENDING_OVERRIDES_MAX] = { 0 };
+static u32 rPendingOverrideHead = 0;
+static u32 rPendingOverrideTail = 0;
+static PendingOverrideStats rPendingOverrideStats = { PENDING_OVERRIDES_MAX, 0, 0, 0, 0 };
+// Items whose cutscene flag is already set, so nothing would push them again
+static ItemOverride rRetryOverrides[RETRY_OVERRIDES_MAX] = { 0 };
+static u32 rRetryOverrideCount = 0;
+
+// Open-addressing set of the keys currently queued, used to reject duplicates
+#define PENDING_KEYS_BITS 5
+#define PENDING_KEYS_SIZE (1 << PENDING_KEYS_BITS) // at least twice PENDING_OVERRIDES_MAX
+static u32 rPendingOverrideKeys[PENDING_KEYS_SIZE] = { 0 };
 static Actor* rDummyActor = NULL;
 
 static ItemOverride rActiveItemOverride = { 0 };
@@ -30,10 +44,6 @@ u32 rActiveItemFastChest = 0;
 static u8 rSatisfiedPendingFrames = 0;
 
 void ItemOverride_Init(void) {
-    while(rItemOverrides[rItemOverrides_Count].key.all != 0) {
-        rItemOverrides_Count++;
-    }
-
     // Create an actor satisfying the minimum requirements to give the player an item
     rDummyActor = rHeap_Alloc(sizeof(Actor));
     rDummyActor->update = (void*)1;
@@ -100,20 +110,7 @@ static ItemOverride_Key ItemOverride_GetSearchKey(Actor* actor, u8 scene, u8 ite
 }
 
 ItemOverride ItemOverride_LookupByKey(ItemOverride_Key key) {
-    s32 start = 0;
-    s32 end = rItemOverrides_Count - 1;
-    while (start <= end) {
-        s32 midIdx = (start + end) / 2;
-        ItemOverride midOvr = rItemOverrides[midIdx];
-        if (key.all < midOvr.key.all) {
-            end = midIdx - 1;
-        } else if (key.all > midOvr.key.all) {
-            start = midIdx + 1;
-        } else {
-            return midOvr;
-        }
-    }
-    return (ItemOverride){ 0 };
+    return OverrideTable_Find(&rItemOverrides, key);
 }
 
 ItemOverride ItemOverride_Lookup(Actor* actor, u8 scene, u8 itemId) {
@@ -148,17 +145,123 @@ static void ItemOverride_Clear(void) {
     rActiveItemFastChest = 0;
 }
 
-static void ItemOverride_PushPendingOverride(ItemOverride override) {
-    for (u32 i = 0; i < ARR_SIZE(rPendingOverrideQueue); ++i) {
-        if (rPendingOverrideQueue[i].key.all == 0) {
-            rPendingOverrideQueue[i] = override;
-            break;
+static u32 PendingKeys_Hash(u32 key) {
+    return (key * 0x9E3779B1) >> (32 - PENDING_KEYS_BITS);
+}
+
+// Returns the slot holding key, or the empty slot where it would go
+static u32 PendingKeys_Find(u32 key) {
+    u32 i = PendingKeys_Hash(key);
+    while (rPendingOverrideKeys[i] != 0 && rPendingOverrideKeys[i] != key) {
+        i = (i + 1) & (PENDING_KEYS_SIZE - 1);
+    }
+    return i;
+}
+
+static void PendingKeys_Remove(u32 key) {
+    u32 i = PendingKeys_Find(key);
+    u32 j = i;
+
+    if (rPendingOverrideKeys[i] == 0) {
+        return;
+    }
+    // Shift the following run back so lookups never stop at the hole early
+    while (1) {
+        rPendingOverrideKeys[i] = 0;
+        while (1) {
+            j = (j + 1) & (PENDING_KEYS_SIZE - 1);
+            if (rPendingOverrideKeys[j] == 0) {
+                return;
+            }
+            u32 home = PendingKeys_Hash(rPendingOverrideKeys[j]);
+            // Move the entry back unless its home lies cyclically in (i, j]
+            if (((j - home) & (PENDING_KEYS_SIZE - 1)) >= ((j - i) & (PENDING_KEYS_SIZE - 1))) {
+                break;
+            }
         }
-        if (rPendingOverrideQueue[i].key.all == override.key.all) {
-            // Prevent duplicate entries
-            break;
+        rPendingOverrideKeys[i] = rPendingOverrideKeys[j];
+        i = j;
+    }
+}
+
+// Returns 0 if the queue is full and the item wasn't queued, so the caller can try again later
+static s32 ItemOverride_PushPendingOverride(ItemOverride override) {
+    u32 queued = rPendingOverrideTail - rPendingOverrideHead;
+    u32 slot;
+
+    if (override.key.all == 0) {
+        return 1;
+    }
+    slot = PendingKeys_Find(override.key.all);
+    if (rPendingOverrideKeys[slot] != 0) {
+        // Prevent duplicate entries
+        return 1;
+    }
+    if (queued >= PENDING_OVERRIDES_MAX) {
+        return 0;
+    }
+
+    rPendingOverrideKeys[slot] = override.key.all;
+    rPendingOverrideQueue[rPendingOverrideTail & (PENDING_OVERRIDES_MAX - 1)] = override;
+    rPendingOverrideTail++;
+
+    if (queued + 1 > rPendingOverrideStats.highWater) {
+        rPendingOverrideStats.highWater = queued + 1;
+    }
+    return 1;
+}
+
+// Queues the waiting items in the order they came in, as many as there's room for
+static void ItemOverride_RetryOverrides(void) {
+    u32 pushed = 0;
+
+    while (pushed < rRetryOverrideCount && ItemOverride_PushPendingOverride(rRetryOverrides[pushed])) {
+        pushed++;
+    }
+    for (u32 i = pushed; i < rRetryOverrideCount; ++i) {
+        rRetryOverrides[i - pushed] = rRetryOverrides[i];
+    }
+    rRetryOverrideCount -= pushed;
+}
+
+// Queues the item, or keeps it to be queued from ItemOverride_Update once there's room
+static void ItemOverride_PushOrRetry(ItemOverride override) {
+    if (override.key.all == 0) {
+        return;
+    }
+    // Items already waiting go first, so everything is given in the order it came in
+    ItemOverride_RetryOverrides();
+    if (rRetryOverrideCount == 0 && ItemOverride_PushPendingOverride(override)) {
+        return;
+    }
+
+    if (rPendingOverrideKeys[PendingKeys_Find(override.key.all)] != 0) {
+        return;
+    }
+    for (u32 i = 0; i < rRetryOverrideCount; ++i) {
+        if (rRetryOverrides[i].key.all == override.key.all) {
+            return;
         }
     }
+    if (rRetryOverrideCount >= RETRY_OVERRIDES_MAX) {
+        rPendingOverrideStats.overflows++;
+        return;
+    }
+    rRetryOverrides[rRetryOverrideCount++] = override;
+}
+
+static ItemOverride ItemOverride_PeekPendingOverride(void) {
+    ItemOverride override = { 0 };
+    if (rPendingOverrideHead != rPendingOverrideTail) {
+        override = rPendingOverrideQueue[rPendingOverrideHead & (PENDING_OVERRIDES_MAX - 1)];
+    }
+    return override;
+}
+
+void ItemOverride_GetPendingStats(PendingOverrideStats* stats) {
+    *stats = rPendingOverrideStats;
+    stats->queued = rPendingOverrideTail - rPendingOverrideHead;
+    stats->waiting = rRetryOverrideCount;
 }
 
 void ItemOverride_PushDelayedOverride(u8 flag) {
@@ -168,15 +271,16 @@ void ItemOverride_PushDelayedOverride(u8 flag) {
     key.flag = flag;
     ItemOverride override = ItemOverride_LookupByKey(key);
     if (override.key.all != 0) {
-        ItemOverride_PushPendingOverride(override);
+        ItemOverride_PushOrRetry(override);
     }
 }
 
 static void ItemOverride_PopPendingOverride(void) {
-    rPendingOverrideQueue[0] = rPendingOverrideQueue[1];
-    rPendingOverrideQueue[1] = rPendingOverrideQueue[2];
-    rPendingOverrideQueue[2].key.all = 0;
-    rPendingOverrideQueue[2].value.all = 0;
+    if (rPendingOverrideHead == rPendingOverrideTail) {
+        return;
+    }
+    PendingKeys_Remove(rPendingOverrideQueue[rPendingOverrideHead & (PENDING_OVERRIDES_MAX - 1)].key.all);
+    rPendingOverrideHead++;
 }
 
 static void ItemOverride_AfterKeyReceived(ItemOverride_Key key) {
@@ -191,8 +295,9 @@ static void ItemOverride_AfterKeyReceived(ItemOverride_Key key) {
 }
 
 static void ItemOverride_PopIceTrap(void) {
-    ItemOverride_Key key = rPendingOverrideQueue[0].key;
-    ItemOverride_Value value = rPendingOverrideQueue[0].value;
+    ItemOverride pending = ItemOverride_PeekPendingOverride();
+    ItemOverride_Key key = pending.key;
+    ItemOverride_Value value = pending.value;
     if (value.itemId == 0x7C) {
         IceTrap_Push();
         ItemOverride_PopPendingOverride();
@@ -233,7 +338,7 @@ static u32 ItemOverride_PlayerIsReady(void) {
 }
 
 static void ItemOverride_TryPendingItem(void) {
-    ItemOverride override = rPendingOverrideQueue[0];
+    ItemOverride override = ItemOverride_PeekPendingOverride();
 
     if (override.key.all == 0) {
         return;
@@ -250,6 +355,7 @@ static void ItemOverride_TryPendingItem(void) {
 }
 
 void ItemOverride_Update(void) {
+    ItemOverride_RetryOverrides();
     ItemOverride_CheckStartingItem();
     ItemOverride_CheckZeldasLetter();
     IceTrap_Update();
@@ -264,7 +370,7 @@ void ItemOverride_Update(void) {
     }
 }
 
-void ItemOverride_GetItem(Actor* fromActor, Player* player, s8 incomingItemId) {
+static void ItemOverride_GetItemImpl(Actor* fromActor, Player* player, s8 incomingItemId) {
     ItemOverride override = { 0 };
     s32 incomingNegative = incomingItemId < 0;
 
@@ -302,6 +408,12 @@ void ItemOverride_GetItem(Actor* fromActor, Player* player, s8 incomingItemId) {
     player->getItemId = incomingNegative ? -baseItemId : baseItemId;
 }
 
+void ItemOverride_GetItem(Actor* fromActor, Player* player, s8 incomingItemId) {
+    PROFILE_BEGIN(tick);
+    ItemOverride_GetItemImpl(fromActor, player, incomingItemId);
+    PROFILE_END(PROFILE_ITEM_OVERRIDE_GET_ITEM, tick);
+}
+
 void ItemOverride_GetItemTextAndItemID(Actor* actor) {
     if (rActiveItemRow != NULL) {
         u16 textId = rActiveItemRow->textId;
@@ -403,8 +515,10 @@ void ItemOverride_CheckZeldasLetter() {
       key.type = OVR_BASE_ITEM;
       key.flag = 0x0B;
       ItemOverride override = ItemOverride_LookupByKey(key);
-      ItemOverride_PushPendingOverride(override);
-      EventSet(0x40);
+      // Only mark the letter as given once it's queued, a full queue is retried next frame
+      if (ItemOverride_PushPendingOverride(override)) {
+          EventSet(0x40);
+      }
   }
 }
 
@@ -414,7 +528,7 @@ void ItemOverride_PushDungeonReward(u8 dungeon) {
     key.type = OVR_TEMPLE;
     key.flag = dungeon;
     ItemOverride override = ItemOverride_LookupByKey(key);
-    ItemOverride_PushPendingOverride(override);
+    ItemOverride_PushOrRetry(override);
 }
 
 void ItemOverride_CheckStartingItem() {
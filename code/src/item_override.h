@@ -40,11 +40,26 @@ typedef struct ItemOverride {
     ItemOverride_Value value;
 } ItemOverride;
 
+// Capacity of the pending item queue, must be a power of two
+#define PENDING_OVERRIDES_MAX 16
+
+// Delayed items and dungeon rewards that found the queue full wait here for room
+#define RETRY_OVERRIDES_MAX 8
+
+typedef struct {
+    u16 capacity;
+    u16 queued;
+    u16 highWater;
+    u16 waiting;   // items waiting for room in the queue
+    u16 overflows; // items dropped because the queue and the waiting list were both full
+} PendingOverrideStats;
+
 ItemOverride ItemOverride_LookupByKey(ItemOverride_Key key);
 ItemOverride ItemOverride_Lookup(Actor* actor, u8 scene, u8 item_id);
 void ItemOverride_PushDelayedOverride(u8 flag);
 void ItemOverride_CheckZeldasLetter();
 void ItemOverride_PushDungeonReward(u8 dungeon);
 void ItemOverride_CheckStartingItem();
+void ItemOverride_GetPendingStats(PendingOverrideStats* stats);
 
 #endif
@@ -0,0 +1,227 @@
+// Every get item row, shared by the patch (item_table.c) and the app (item_list.cpp).
+// Define ITEM_ROW before including this file; it is not include-guarded on purpose.
+//
+// ITEM_ROW(getItemId, baseItemId, chestType, actionId, textId, objectId, objectModelIdx, objectMeshId,
+//          graphicId, upgrade, effect, effectArg1, effectArg2)
+
+//TODO: All the object model indexes
+ITEM_ROW(0x01, 0x4D, 1, 0x8E, 0x0032, 0x00CE, 0x00, 0x00, 0x20, ItemUpgrade_BombsToRupee, ItemEffect_None, -1, -1) // Bombs (5)
+ITEM_ROW(0x02, 0x4D, 1, 0x8C, 0x0034, 0x00BB, 0x00, 0x00, 0x12, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Nuts (5)
+ITEM_ROW(0x03, 0x4D, 1, 0x09, 0x0033, 0x00D9, 0x00, 0x00, 0x28, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bombchu (10)
+ITEM_ROW(0x04, 0x53, 0, 0x03, 0x0031, 0x00E9, 0x00, 0x00, 0x35, ItemUpgrade_None, ItemEffect_PlaceMagicArrowsInInventory, 0, -1) // Fairy Bow
+ITEM_ROW(0x05, 0x53, 0, 0x06, 0x0030, 0x00E7, 0x00, 0x00, 0x33, ItemUpgrade_None, ItemEffect_None, -1, -1) // Fairy Slingshot
+ITEM_ROW(0x06, 0x53, 0, 0x0E, 0x0035, 0x00E8, 0x00, 0x00, 0x34, ItemUpgrade_None, ItemEffect_None, -1, -1) // Boomerang
+ITEM_ROW(0x07, 0x4D, 1, 0x00, 0x0037, 0x00C7, 0x00, 0x00, 0x1B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Stick
+ITEM_ROW(0x08, 0x53, 0, 0x0A, 0x0036, 0x00DD, 0x00, 0x00, 0x2D, ItemUpgrade_None, ItemEffect_None, -1, -1) // Hookshot
+ITEM_ROW(0x09, 0x53, 0, 0x0B, 0x004F, 0x00DD, 0x01, 0x00, 0x2E, ItemUpgrade_None, ItemEffect_None, -1, -1) // Longshot
+ITEM_ROW(0x0A, 0x53, 0, 0x0F, 0x0039, 0x00EA, 0x00, 0x00, 0x36, ItemUpgrade_None, ItemEffect_None, -1, -1) // Lens of Truth
+ITEM_ROW(0x0B, 0x53, 0, 0x23, 0x0069, 0x00EF, 0x00, 0x00, 0x3B, ItemUpgrade_None, ItemEffect_OpenMaskShop, -1, -1) // Zelda's Letter
+ITEM_ROW(0x0C, 0x53, 0, 0x08, 0x003A, 0x00DE, 0x00, 0x00, 0x2F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Ocarina of Time
+ITEM_ROW(0x0D, 0x53, 0, 0x11, 0x0038, 0x00F6, 0x00, 0x00, 0x41, ItemUpgrade_None, ItemEffect_None, -1, -1) // Megaton Hammer
+ITEM_ROW(0x0E, 0x53, 0, 0x2F, 0x0002, 0x0109, 0x00, 0x00, 0x5E, ItemUpgrade_None, ItemEffect_None, -1, -1) // Cojiro
+ITEM_ROW(0x0F, 0x53, 0, 0x14, 0x0042, 0x00C6, 0x00, 0x00, 0x01, ItemUpgrade_None, ItemEffect_None, -1, -1) // Empty Bottle
+ITEM_ROW(0x10, 0x53, 0, 0x15, 0x0043, 0x00EB, 0x00, 0x00, 0x38, ItemUpgrade_None, ItemEffect_None, -1, -1) // Red Potion
+ITEM_ROW(0x11, 0x53, 0, 0x16, 0x0044, 0x00EB, 0x01, 0x00, 0x37, ItemUpgrade_None, ItemEffect_None, -1, -1) // Green Potion
+ITEM_ROW(0x12, 0x53, 0, 0x17, 0x0045, 0x00EB, 0x02, 0x00, 0x39, ItemUpgrade_None, ItemEffect_None, -1, -1) // Blue Potion
+ITEM_ROW(0x13, 0x53, 0, 0x18, 0x0046, 0x00C6, 0x00, 0x00, 0x01, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bottled Fairy
+ITEM_ROW(0x14, 0x53, 0, 0x1A, 0x0098, 0x00DF, 0x00, 0x00, 0x30, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bottled Lon Lon Milk
+ITEM_ROW(0x15, 0x53, 0, 0x1B, 0x0099, 0x010B, 0x00, 0x00, 0x45, ItemUpgrade_LetterToBottle, ItemEffect_None, -1, -1) // Bottled Ruto's Letter
+ITEM_ROW(0x16, 0x53, 1, 0x10, 0x0048, 0x00F3, 0x00, 0x00, 0x3E, ItemUpgrade_None, ItemEffect_None, -1, -1) // Magic Bean
+ITEM_ROW(0x17, 0x53, 0, 0x25, 0x0010, 0x0136, 0x00, 0x00, 0x4F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Skull Mask
+ITEM_ROW(0x18, 0x53, 0, 0x26, 0x0011, 0x0135, 0x00, 0x00, 0x32, ItemUpgrade_None, ItemEffect_None, -1, -1) // Spooky Mask
+ITEM_ROW(0x19, 0x53, 0, 0x22, 0x000B, 0x0109, 0x00, 0x00, 0x44, ItemUpgrade_None, ItemEffect_None, -1, -1) // Chicken
+ITEM_ROW(0x1A, 0x53, 0, 0x24, 0x0012, 0x0134, 0x00, 0x00, 0x31, ItemUpgrade_None, ItemEffect_None, -1, -1) // Keaton Mask
+ITEM_ROW(0x1B, 0x53, 0, 0x27, 0x0013, 0x0137, 0x00, 0x00, 0x50, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bunny Hood
+ITEM_ROW(0x1C, 0x53, 0, 0x2B, 0x0017, 0x0138, 0x00, 0x00, 0x51, ItemUpgrade_None, ItemEffect_None, -1, -1) // Mask of Truth
+ITEM_ROW(0x1D, 0x53, 0, 0x2D, 0x9001, 0x00DA, 0x00, 0x00, 0x29, ItemUpgrade_None, ItemEffect_None, -1, -1) // Pocket Egg
+ITEM_ROW(0x1E, 0x53, 0, 0x2E, 0x000B, 0x0109, 0x00, 0x00, 0x44, ItemUpgrade_None, ItemEffect_None, -1, -1) // Pocket Cucco
+ITEM_ROW(0x1F, 0x53, 0, 0x30, 0x0003, 0x0141, 0x00, 0x00, 0x54, ItemUpgrade_None, ItemEffect_None, -1, -1) // Odd Mushroom
+ITEM_ROW(0x20, 0x53, 0, 0x31, 0x0004, 0x0140, 0x00, 0x00, 0x53, ItemUpgrade_None, ItemEffect_None, -1, -1) // Odd Potion
+ITEM_ROW(0x21, 0x53, 0, 0x32, 0x0005, 0x00F5, 0x00, 0x00, 0x40, ItemUpgrade_None, ItemEffect_None, -1, -1) // Poacher's Saw
+ITEM_ROW(0x22, 0x53, 0, 0x33, 0x0008, 0x0143, 0x00, 0x00, 0x56, ItemUpgrade_None, ItemEffect_None, -1, -1) // Goron's Sword (Broken)
+ITEM_ROW(0x23, 0x53, 0, 0x34, 0x0009, 0x0146, 0x00, 0x00, 0x57, ItemUpgrade_None, ItemEffect_None, -1, -1) // Prescription
+ITEM_ROW(0x24, 0x53, 0, 0x35, 0x000D, 0x0149, 0x00, 0x00, 0x5A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Eyeball Frog
+ITEM_ROW(0x25, 0x53, 0, 0x36, 0x000E, 0x013F, 0x00, 0x00, 0x52, ItemUpgrade_None, ItemEffect_None, -1, -1) // Eye Drops
+ITEM_ROW(0x26, 0x53, 0, 0x37, 0x000A, 0x0142, 0x00, 0x00, 0x55, ItemUpgrade_None, ItemEffect_None, -1, -1) // Claim Check
+ITEM_ROW(0x27, 0x53, 0, 0x3B, 0x00A4, 0x018D, 0x00, 0x00, 0x74, ItemUpgrade_None, ItemEffect_GiveChildKokiriSword, -1, -1) // Kokiri Sword
+ITEM_ROW(0x28, 0x53, 0, 0x3D, 0x004B, 0x00F8, 0x00, 0x00, 0x43, ItemUpgrade_None, ItemEffect_None, -1, -1) // Giant's Knife
+ITEM_ROW(0x29, 0x53, 1, 0x3E, 0x004C, 0x00CB, 0x00, 0x00, 0x1D, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Shield
+ITEM_ROW(0x2A, 0x53, 1, 0x3F, 0x004D, 0x00DC, 0x00, 0x00, 0x2C, ItemUpgrade_None, ItemEffect_None, -1, -1) // Hylian Shield
+ITEM_ROW(0x2B, 0x53, 0, 0x40, 0x004E, 0x00EE, 0x00, 0x00, 0x3A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Mirror Shield
+ITEM_ROW(0x2C, 0x53, 0, 0x42, 0x0050, 0x00F2, 0x00, 0x00, 0x3C, ItemUpgrade_None, ItemEffect_None, -1, -1) // Goron Tunic
+ITEM_ROW(0x2D, 0x53, 0, 0x43, 0x0051, 0x00F2, 0x01, 0x00, 0x3D, ItemUpgrade_None, ItemEffect_None, -1, -1) // Zora Tunic
+ITEM_ROW(0x2E, 0x53, 0, 0x45, 0x0053, 0x0118, 0x00, 0x00, 0x47, ItemUpgrade_None, ItemEffect_None, -1, -1) // Iron Boots
+ITEM_ROW(0x2F, 0x53, 0, 0x46, 0x0054, 0x0157, 0x00, 0x00, 0x5F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Hover Boots
+ITEM_ROW(0x30, 0x53, 0, 0x4B, 0x0056, 0x00BE, 0x00, 0x00, 0x16, ItemUpgrade_None, ItemEffect_None, -1, -1) // Big Quiver
+ITEM_ROW(0x31, 0x53, 0, 0x4C, 0x0057, 0x00BE, 0x00, 0x00, 0x17, ItemUpgrade_None, ItemEffect_None, -1, -1) // Biggest Quiver
+ITEM_ROW(0x32, 0x53, 0, 0x4D, 0x0058, 0x00BF, 0x00, 0x00, 0x18, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bomb Bag
+ITEM_ROW(0x33, 0x53, 0, 0x4E, 0x0059, 0x00BF, 0x00, 0x00, 0x19, ItemUpgrade_None, ItemEffect_None, -1, -1) // Big Bomb Bag
+ITEM_ROW(0x34, 0x53, 0, 0x4F, 0x005A, 0x00BF, 0x00, 0x00, 0x1A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Biggest Bomb Bag
+ITEM_ROW(0x35, 0x53, 0, 0x51, 0x005B, 0x012D, 0x00, 0x00, 0x49, ItemUpgrade_None, ItemEffect_None, -1, -1) // Silver Gauntlets
+ITEM_ROW(0x36, 0x53, 0, 0x52, 0x005C, 0x012D, 0x00, 0x00, 0x4A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Golden Gauntlets
+ITEM_ROW(0x37, 0x53, 0, 0x53, 0x00CD, 0x00DB, 0x00, 0x00, 0x2A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Silver Scale
+ITEM_ROW(0x38, 0x53, 0, 0x54, 0x00CE, 0x00DB, 0x01, 0x00, 0x2B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Golden Scale
+ITEM_ROW(0x39, 0x53, 0, 0x6F, 0x0068, 0x00C8, 0x01, 0x00, 0x21, ItemUpgrade_None, ItemEffect_None, -1, -1) // Stone of Agony
+ITEM_ROW(0x3A, 0x53, 0, 0x70, 0x007B, 0x00D7, 0x00, 0x00, 0x24, ItemUpgrade_None, ItemEffect_None, -1, -1) // Gerudo Membership Card
+ITEM_ROW(0x3B, 0x53, 0, 0x41, 0x004A, 0x010E, 0x02, 0x00, 0x46, ItemUpgrade_None, ItemEffect_GiveFairyOcarina, -1, -1) // Fairy Ocarina
+ITEM_ROW(0x3C, 0x4D, 1, 0x58, 0x00DC, 0x0119, 0x00, 0x00, 0x48, ItemUpgrade_SeedsToRupee, ItemEffect_None, -1, -1) // Deku Seeds (5)
+ITEM_ROW(0x3D, 0x3D, 1, 0x72, 0x00C6, 0x00BD, 0x00, 0x00, 0x13, ItemUpgrade_None, ItemEffect_FullHeal, -1, -1) // Heart Container
+ITEM_ROW(0x3E, 0x3E, 1, 0x7A, 0x00C2, 0x00BD, 0x01, 0x00, 0x14, ItemUpgrade_None, ItemEffect_FullHeal, -1, -1) // Piece of Heart
+ITEM_ROW(0x3F, 0x53, 2, 0x74, 0x00C7, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Boss Key
+ITEM_ROW(0x40, 0x53, 1, 0x75, 0x0067, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Compass
+ITEM_ROW(0x41, 0x53, 1, 0x76, 0x0066, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_None, -1, -1) // Map
+ITEM_ROW(0x42, 0x53, 3, 0x77, 0x0060, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_None, -1, -1) // Small Key
+ITEM_ROW(0x43, 0x53, 1, 0x78, 0x0052, 0x00CD, 0x00, 0x00, 0x1E, ItemUpgrade_None, ItemEffect_None, -1, -1) // Small Magic Jar
+ITEM_ROW(0x44, 0x53, 1, 0x79, 0x0052, 0x00CD, 0x00, 0x00, 0x1F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Large Magic Jar
+ITEM_ROW(0x45, 0x53, 0, 0x56, 0x005E, 0x00D1, 0x00, 0x00, 0x22, ItemUpgrade_None, ItemEffect_FillWalletUpgrade, 1, -1) // Adult's Wallet
+ITEM_ROW(0x46, 0x53, 0, 0x57, 0x005F, 0x00D1, 0x01, 0x00, 0x23, ItemUpgrade_None, ItemEffect_FillWalletUpgrade, 2, -1) // Giant's Wallet
+ITEM_ROW(0x47, 0x53, 0, 0x21, 0x009A, 0x00DA, 0x00, 0x00, 0x29, ItemUpgrade_None, ItemEffect_None, -1, -1) // Weird Egg
+ITEM_ROW(0x48, 0x4D, 1, 0x83, 0x0055, 0x00B7, 0x00, 0x00, 0x09, ItemUpgrade_None, ItemEffect_None, -1, -1) // Recovery Heart
+ITEM_ROW(0x49, 0x4D, 1, 0x92, 0x00E6, 0x00D8, 0x00, 0x00, 0x25, ItemUpgrade_ArrowsToRupee, ItemEffect_None, -1, -1) // Arrows (5)
+ITEM_ROW(0x4A, 0x4D, 1, 0x93, 0x00E6, 0x00D8, 0x00, 0x00, 0x26, ItemUpgrade_ArrowsToRupee, ItemEffect_None, -1, -1) // Arrows (10)
+ITEM_ROW(0x4B, 0x4D, 1, 0x94, 0x00E6, 0x00D8, 0x00, 0x00, 0x27, ItemUpgrade_ArrowsToRupee, ItemEffect_None, -1, -1) // Arrows (30)
+ITEM_ROW(0x4C, 0x4D, 1, 0x84, 0x006F, 0x017F, 0x00, 0x6C, 0x6D, ItemUpgrade_None, ItemEffect_None, -1, -1) // Green Rupee
+ITEM_ROW(0x4D, 0x4D, 1, 0x85, 0x00CC, 0x017F, 0x00, 0x6D, 0x6E, ItemUpgrade_None, ItemEffect_None, -1, -1) // Blue Rupee
+ITEM_ROW(0x4E, 0x4D, 1, 0x86, 0x00F0, 0x017F, 0x00, 0x6E, 0x6F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Red Rupee
+ITEM_ROW(0x4F, 0x3D, 1, 0x72, 0x00C6, 0x00BD, 0x00, 0x00, 0x13, ItemUpgrade_None, ItemEffect_FullHeal, -1, -1) // Heart Container
+ITEM_ROW(0x50, 0x53, 0, 0x82, 0x0098, 0x00DF, 0x00, 0x00, 0x30, ItemUpgrade_None, ItemEffect_None, -1, -1) // Lon Lon Milk (Refill)
+ITEM_ROW(0x51, 0x53, 0, 0x28, 0x0014, 0x0150, 0x00, 0x00, 0x5B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Goron Mask
+ITEM_ROW(0x52, 0x53, 0, 0x29, 0x0015, 0x0151, 0x00, 0x00, 0x5C, ItemUpgrade_None, ItemEffect_None, -1, -1) // Zora Mask
+ITEM_ROW(0x53, 0x53, 0, 0x2A, 0x0016, 0x0152, 0x00, 0x00, 0x5D, ItemUpgrade_None, ItemEffect_None, -1, -1) // Gerudo Mask
+ITEM_ROW(0x54, 0x53, 0, 0x50, 0x0079, 0x0147, 0x00, 0x00, 0x58, ItemUpgrade_None, ItemEffect_None, -1, -1) // Goron's Bracelet
+ITEM_ROW(0x55, 0x4D, 1, 0x87, 0x00F1, 0x017F, 0x00, 0x70, 0x71, ItemUpgrade_None, ItemEffect_None, -1, -1) // Purple Rupee
+ITEM_ROW(0x56, 0x4D, 1, 0x88, 0x00F2, 0x017F, 0x00, 0x71, 0x72, ItemUpgrade_None, ItemEffect_None, -1, -1) // Huge Rupee
+ITEM_ROW(0x57, 0x53, 0, 0x3D, 0x000C, 0x00F8, 0x00, 0x00, 0x43, ItemUpgrade_None, ItemEffect_GiveBiggoronSword, -1, -1) // Biggoron's Sword
+ITEM_ROW(0x58, 0x53, 0, 0x04, 0x0070, 0x0158, 0x00, 0x00, 0x60, ItemUpgrade_None, ItemEffect_PlaceMagicArrowsInInventory, 1, -1) // Fire Arrow
+ITEM_ROW(0x59, 0x53, 0, 0x0C, 0x0071, 0x0158, 0x01, 0x00, 0x61, ItemUpgrade_None, ItemEffect_PlaceMagicArrowsInInventory, 2, -1) // Ice Arrow
+ITEM_ROW(0x5A, 0x53, 0, 0x12, 0x0072, 0x0158, 0x02, 0x00, 0x62, ItemUpgrade_None, ItemEffect_PlaceMagicArrowsInInventory, 3, -1) // Light Arrow
+ITEM_ROW(0x5B, 0x5B, 1, 0x71, 0x00B4, 0x0024, 0x02, 0x00, 0x63, ItemUpgrade_None, ItemEffect_None, -1, -1) // Gold Skulltula Token
+ITEM_ROW(0x5C, 0x53, 0, 0x05, 0x00AD, 0x015D, 0x00, 0x00, 0x64, ItemUpgrade_None, ItemEffect_None, -1, -1) // Din's Fire
+ITEM_ROW(0x5D, 0x53, 0, 0x0D, 0x00AE, 0x015D, 0x01, 0x00, 0x65, ItemUpgrade_None, ItemEffect_None, -1, -1) // Farore's Wind
+ITEM_ROW(0x5E, 0x53, 0, 0x13, 0x00AF, 0x015D, 0x02, 0x00, 0x66, ItemUpgrade_None, ItemEffect_None, -1, -1) // Nayru's Love
+ITEM_ROW(0x5F, 0x53, 0, 0x47, 0x0007, 0x017B, 0x00, 0x00, 0x6C, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bullet Bag (30)
+ITEM_ROW(0x60, 0x53, 0, 0x48, 0x0007, 0x017B, 0x00, 0x00, 0x6C, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bullet Bag (40)
+ITEM_ROW(0x61, 0x4D, 1, 0x8A, 0x0037, 0x00C7, 0x00, 0x00, 0x1B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Sticks (5)
+ITEM_ROW(0x62, 0x4D, 1, 0x8B, 0x0037, 0x00C7, 0x00, 0x00, 0x1B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Sticks (10)
+ITEM_ROW(0x63, 0x4D, 1, 0x8C, 0x0034, 0x00BB, 0x00, 0x00, 0x12, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Nuts (5)
+ITEM_ROW(0x64, 0x4D, 1, 0x8D, 0x0034, 0x00BB, 0x00, 0x00, 0x12, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Nuts (10)
+ITEM_ROW(0x65, 0x4D, 1, 0x02, 0x0032, 0x00CE, 0x00, 0x00, 0x20, ItemUpgrade_BombsToRupee, ItemEffect_None, -1, -1) // Bomb
+ITEM_ROW(0x66, 0x4D, 1, 0x8F, 0x0032, 0x00CE, 0x00, 0x00, 0x20, ItemUpgrade_BombsToRupee, ItemEffect_None, -1, -1) // Bombs (10)
+ITEM_ROW(0x67, 0x4D, 1, 0x90, 0x0032, 0x00CE, 0x00, 0x00, 0x20, ItemUpgrade_BombsToRupee, ItemEffect_None, -1, -1) // Bombs (20)
+ITEM_ROW(0x68, 0x4D, 1, 0x91, 0x0032, 0x00CE, 0x00, 0x00, 0x20, ItemUpgrade_BombsToRupee, ItemEffect_None, -1, -1) // Bombs (30)
+ITEM_ROW(0x69, 0x4D, 1, 0x95, 0x00DC, 0x0119, 0x00, 0x00, 0x48, ItemUpgrade_SeedsToRupee, ItemEffect_None, -1, -1) // Deku Seeds (30)
+ITEM_ROW(0x6A, 0x4D, 1, 0x96, 0x0033, 0x00D9, 0x00, 0x00, 0x28, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bombchu (5)
+ITEM_ROW(0x6B, 0x4D, 1, 0x97, 0x0033, 0x00D9, 0x00, 0x00, 0x28, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bombchu (20)
+ITEM_ROW(0x6C, 0x53, 0, 0x19, 0x0047, 0x00F4, 0x00, 0x00, 0x3F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Fish (Refill)
+ITEM_ROW(0x6D, 0x53, 0, 0x1D, 0x007A, 0x0174, 0x00, 0x00, 0x68, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bugs (Refill)
+ITEM_ROW(0x6E, 0x53, 0, 0x1C, 0x005D, 0x0173, 0x00, 0x00, 0x67, ItemUpgrade_None, ItemEffect_None, -1, -1) // Blue Fire (Refill)
+ITEM_ROW(0x6F, 0x53, 0, 0x20, 0x0097, 0x0176, 0x00, 0x00, 0x6A, ItemUpgrade_None, ItemEffect_None, -1, -1) // Poe (Refill)
+ITEM_ROW(0x70, 0x53, 0, 0x1E, 0x00F9, 0x019A, 0x00, 0x00, 0x70, ItemUpgrade_None, ItemEffect_None, -1, -1) // Big Poe (Refill)
+ITEM_ROW(0x71, 0x53, 1, 0x77, 0x00F3, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_None, -1, -1) // Small Key (Chest Game)
+ITEM_ROW(0x72, 0x4D, 1, 0x84, 0x00F4, 0x017F, 0x00, 0x6C, 0x6D, ItemUpgrade_None, ItemEffect_None, -1, -1) // Green Rupee (Chest Game)
+ITEM_ROW(0x73, 0x4D, 1, 0x85, 0x00F5, 0x017F, 0x00, 0x6D, 0x6E, ItemUpgrade_None, ItemEffect_None, -1, -1) // Blue Rupee (Chest Game)
+ITEM_ROW(0x74, 0x4D, 1, 0x86, 0x00F6, 0x017F, 0x00, 0x6E, 0x6F, ItemUpgrade_None, ItemEffect_None, -1, -1) // Red Rupee (Chest Game)
+ITEM_ROW(0x75, 0x4D, 1, 0x87, 0x00F7, 0x017F, 0x00, 0x70, 0x71, ItemUpgrade_None, ItemEffect_None, -1, -1) // Purple Rupee (Chest Game)
+ITEM_ROW(0x76, 0x53, 1, 0x7A, 0x00FA, 0x00BD, 0x01, 0x00, 0x14, ItemUpgrade_None, ItemEffect_FullHeal, -1, -1) // Piece of Heart (Chest Game)
+ITEM_ROW(0x77, 0x53, 1, 0x98, 0x0090, 0x00C7, 0x00, 0x00, 0x1B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Stick Upgrade (20)
+ITEM_ROW(0x78, 0x53, 1, 0x99, 0x0091, 0x00C7, 0x00, 0x00, 0x1B, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Stick Upgrade (30)
+ITEM_ROW(0x79, 0x53, 1, 0x9A, 0x00A7, 0x00BB, 0x00, 0x00, 0x12, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Nut Upgrade (30)
+ITEM_ROW(0x7A, 0x53, 1, 0x9B, 0x00A8, 0x00BB, 0x00, 0x00, 0x12, ItemUpgrade_None, ItemEffect_None, -1, -1) // Deku Nut Upgrade (40)
+ITEM_ROW(0x7B, 0x53, 0, 0x49, 0x006C, 0x017B, 0x00, 0x00, 0x73, ItemUpgrade_None, ItemEffect_None, -1, -1) // Bullet Bag (50)
+ITEM_ROW(0x7C, 0x53, 0, 0x41, 0x9002, 0x0000, 0x00, 0x00, 0x00, ItemUpgrade_None, ItemEffect_IceTrap, -1, -1) // Ice Trap
+
+ITEM_ROW(0x80,   -1, 0,   -1,     -1, 0x00DD, 0x00, 0x00, 0x2D, ItemUpgrade_Hookshot,  ItemEffect_None, -1, -1) // Progressive Hookshot
+ITEM_ROW(0x81,   -1, 0,   -1,     -1, 0x0147, 0x00, 0x00, 0x58, ItemUpgrade_Strength,  ItemEffect_None, -1, -1) // Progressive Strength
+ITEM_ROW(0x82,   -1, 0,   -1,     -1, 0x00BF, 0x00, 0x00, 0x18, ItemUpgrade_BombBag,   ItemEffect_None, -1, -1) // Progressive Bomb Bag
+ITEM_ROW(0x83,   -1, 0,   -1,     -1, 0x00E9, 0x00, 0x00, 0x35, ItemUpgrade_Quiver,    ItemEffect_None, -1, -1) // Progressive Bow
+ITEM_ROW(0x84,   -1, 0,   -1,     -1, 0x00E7, 0x00, 0x00, 0x33, ItemUpgrade_BulletBag, ItemEffect_None, -1, -1) // Progressive Slingshot
+ITEM_ROW(0x85,   -1, 0,   -1,     -1, 0x00D1, 0x00, 0x00, 0x22, ItemUpgrade_Wallet,    ItemEffect_None, -1, -1) // Progressive Wallet
+ITEM_ROW(0x86,   -1, 0,   -1,     -1, 0x00DB, 0x00, 0x00, 0x2A, ItemUpgrade_Scale,     ItemEffect_None, -1, -1) // Progressive Scale
+ITEM_ROW(0x87,   -1, 1,   -1,     -1, 0x00BB, 0x00, 0x00, 0x12, ItemUpgrade_Nuts,      ItemEffect_None, -1, -1) // Progressive Nut Capacity
+ITEM_ROW(0x88,   -1, 1,   -1,     -1, 0x00C7, 0x00, 0x00, 0x1B, ItemUpgrade_Sticks,    ItemEffect_None, -1, -1) // Progressive Stick Capacity
+ITEM_ROW(0x89,   -1, 0,   -1,     -1, 0x00D9, 0x00, 0x00, 0x28, ItemUpgrade_Bombchu,   ItemEffect_None, -1, -1) // Progressive Bombchus
+ITEM_ROW(0x8A,   -1, 0,   -1,     -1, 0x00CD, 0x00, 0x00, 0x1E, ItemUpgrade_Magic,     ItemEffect_None, -1, -1) // Progressive Magic Meter
+ITEM_ROW(0x8B,   -1, 0,   -1,     -1, 0x010E, 0x00, 0x00, 0x46, ItemUpgrade_Ocarina,   ItemEffect_None, -1, -1) // Progressive Ocarina
+
+ITEM_ROW(0x8C, 0x53, 0, 0x41, 0x0043, 0x0199, 0x00, 0x00, 0x81, ItemUpgrade_None, ItemEffect_GiveBottle, 0x15, -1) // Bottle with Red Potion
+ITEM_ROW(0x8D, 0x53, 0, 0x41, 0x0044, 0x0199, 0x01, 0x00, 0x82, ItemUpgrade_None, ItemEffect_GiveBottle, 0x16, -1) // Bottle with Green Potion
+ITEM_ROW(0x8E, 0x53, 0, 0x41, 0x0045, 0x0199, 0x02, 0x00, 0x83, ItemUpgrade_None, ItemEffect_GiveBottle, 0x17, -1) // Bottle with Blue Potion
+ITEM_ROW(0x8F, 0x53, 0, 0x41, 0x0046, 0x0177, 0x00, 0x00, 0x6B, ItemUpgrade_None, ItemEffect_GiveBottle, 0x18, -1) // Bottle with Fairy
+ITEM_ROW(0x90, 0x53, 0, 0x41, 0x0047, 0x00F4, 0x00, 0x00, 0x3F, ItemUpgrade_None, ItemEffect_GiveBottle, 0x19, -1) // Bottle with Fish
+ITEM_ROW(0x91, 0x53, 0, 0x41, 0x005D, 0x0173, 0x00, 0x00, 0x67, ItemUpgrade_None, ItemEffect_GiveBottle, 0x1C, -1) // Bottle with Blue Fire
+ITEM_ROW(0x92, 0x53, 0, 0x41, 0x007A, 0x0174, 0x00, 0x00, 0x68, ItemUpgrade_None, ItemEffect_GiveBottle, 0x1D, -1) // Bottle with Bugs
+ITEM_ROW(0x93, 0x53, 0, 0x41, 0x00F9, 0x019A, 0x00, 0x00, 0x70, ItemUpgrade_None, ItemEffect_GiveBottle, 0x1E, -1) // Bottle with Big Poe
+ITEM_ROW(0x94, 0x53, 0, 0x41, 0x0097, 0x0176, 0x00, 0x00, 0x6A, ItemUpgrade_None, ItemEffect_GiveBottle, 0x20, -1) // Bottle with Poe
+
+ITEM_ROW(0x95, 0x53, 2, 0x41, 0x09D4, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x01, DUNGEON_FOREST_TEMPLE ) // Forest Temple Boss Key
+ITEM_ROW(0x96, 0x53, 2, 0x41, 0x09D5, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x01, DUNGEON_FIRE_TEMPLE   ) // Fire Temple Boss Key
+ITEM_ROW(0x97, 0x53, 2, 0x41, 0x09D6, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x01, DUNGEON_WATER_TEMPLE  ) // Water Temple Boss Key
+ITEM_ROW(0x98, 0x53, 2, 0x41, 0x09D7, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x01, DUNGEON_SPIRIT_TEMPLE ) // Spirit Temple Boss Key
+ITEM_ROW(0x99, 0x53, 2, 0x41, 0x09D8, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x01, DUNGEON_SHADOW_TEMPLE ) // Shadow Temple Boss Key
+ITEM_ROW(0x9A, 0x53, 2, 0x41, 0x09D9, 0x00B9, 0x00, 0x00, 0x0A, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x01, DUNGEON_GANONS_CASTLE_SECOND_PART  ) // Ganon's Castle Boss Key
+
+ITEM_ROW(0x9B, 0x53, 1, 0x41, 0x09DA, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_DEKU_TREE         ) // Deku Tree Compass
+ITEM_ROW(0x9C, 0x53, 1, 0x41, 0x09DB, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_DODONGOS_CAVERN   ) // Dodongo's Cavern Compass
+ITEM_ROW(0x9D, 0x53, 1, 0x41, 0x09DC, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_JABUJABUS_BELLY   ) // Jabu Jabu Compass
+ITEM_ROW(0x9E, 0x53, 1, 0x41, 0x09DD, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_FOREST_TEMPLE     ) // Forest Temple Compass
+ITEM_ROW(0x9F, 0x53, 1, 0x41, 0x09DE, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_FIRE_TEMPLE       ) // Fire Temple Compass
+ITEM_ROW(0xA0, 0x53, 1, 0x41, 0x09DF, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_WATER_TEMPLE      ) // Water Temple Compass
+ITEM_ROW(0xA1, 0x53, 1, 0x41, 0x09E0, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_SPIRIT_TEMPLE     ) // Spirit Temple Compass
+ITEM_ROW(0xA2, 0x53, 1, 0x41, 0x09E1, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_SHADOW_TEMPLE     ) // Shadow Temple Compass
+ITEM_ROW(0xA3, 0x53, 1, 0x41, 0x09E2, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_BOTTOM_OF_THE_WELL) // Bottom of the Well Compass
+ITEM_ROW(0xA4, 0x53, 1, 0x41, 0x09E3, 0x00B8, 0x00, 0x00, 0x0B, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x02, DUNGEON_ICE_CAVERN        ) // Ice Cavern Compass
+
+ITEM_ROW(0xA5, 0x53, 1, 0x41, 0x09E4, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_DEKU_TREE      ) // Deku Tree Map
+ITEM_ROW(0xA6, 0x53, 1, 0x41, 0x09E5, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_DODONGOS_CAVERN) // Dodongo's Cavern Map
+ITEM_ROW(0xA7, 0x53, 1, 0x41, 0x09E6, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_JABUJABUS_BELLY) // Jabu Jabu Map
+ITEM_ROW(0xA8, 0x53, 1, 0x41, 0x09E7, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_FOREST_TEMPLE  ) // Forest Temple Map
+ITEM_ROW(0xA9, 0x53, 1, 0x41, 0x09E8, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_FIRE_TEMPLE    ) // Fire Temple Map
+ITEM_ROW(0xAA, 0x53, 1, 0x41, 0x09E9, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_WATER_TEMPLE   ) // Water Temple Map
+ITEM_ROW(0xAB, 0x53, 1, 0x41, 0x09EA, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_SPIRIT_TEMPLE  ) // Spirit Temple Map
+ITEM_ROW(0xAC, 0x53, 1, 0x41, 0x09EB, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_SHADOW_TEMPLE  ) // Shadow Temple Map
+ITEM_ROW(0xAD, 0x53, 1, 0x41, 0x09EC, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_BOTTOM_OF_THE_WELL   ) // Bottom of the Well Map
+ITEM_ROW(0xAE, 0x53, 1, 0x41, 0x09ED, 0x00C8, 0x00, 0x00, 0x1C, ItemUpgrade_None, ItemEffect_GiveDungeonItem, 0x04, DUNGEON_ICE_CAVERN     ) // Ice Cavern Map
+
+ITEM_ROW(0xAF, 0x53, 3, 0x41, 0x09EE, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_FOREST_TEMPLE, -1) // Forest Temple Small Key
+ITEM_ROW(0xB0, 0x53, 3, 0x41, 0x09EF, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_FIRE_TEMPLE,   -1) // Fire Temple Small Key
+ITEM_ROW(0xB1, 0x53, 3, 0x41, 0x09F0, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_WATER_TEMPLE,  -1) // Water Temple Small Key
+ITEM_ROW(0xB2, 0x53, 3, 0x41, 0x09F1, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_SPIRIT_TEMPLE, -1) // Spirit Temple Small Key
+ITEM_ROW(0xB3, 0x53, 3, 0x41, 0x09F2, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_SHADOW_TEMPLE, -1) // Shadow Temple Small Key
+ITEM_ROW(0xB4, 0x53, 3, 0x41, 0x09F3, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_BOTTOM_OF_THE_WELL,       -1) // Bottom of the Well Small Key
+ITEM_ROW(0xB5, 0x53, 3, 0x41, 0x09F4, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_GERUDO_TRAINING_GROUNDS,  -1) // Gerudo Training Small Key
+ITEM_ROW(0xB6, 0x53, 3, 0x41, 0x09F5, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_GERUDO_FORTRESS,          -1) // Gerudo Fortress Small Key
+ITEM_ROW(0xB7, 0x53, 3, 0x41, 0x09F6, 0x00AA, 0x00, 0x00, 0x02, ItemUpgrade_None, ItemEffect_GiveSmallKey, DUNGEON_GANONS_CASTLE_FIRST_PART, -1) // Ganon's Castle Small Key
+
+ITEM_ROW(0xB8, 0x53, 0, 0x41, 0x00E9, 0x0004, 0x00, 0x00, 0x04, ItemUpgrade_None, ItemEffect_GiveDefense,     -1, -1) // Double Defense
+ITEM_ROW(0xB9, 0x53, 0, 0x41, 0x00E4, 0x00CD, 0x00, 0x00, 0x1E, ItemUpgrade_None, ItemEffect_GiveMagic,       -1, -1) // Magic Meter
+ITEM_ROW(0xBA, 0x53, 0, 0x41, 0x00E8, 0x00CD, 0x00, 0x00, 0x1F, ItemUpgrade_None, ItemEffect_GiveDoubleMagic, -1, -1) // Double Magic
+
+ITEM_ROW(0xBB, 0x53, 0, 0x41, 0x0073, 0x0010, 0x00, 0x01, 0x06, ItemUpgrade_None, ItemEffect_GiveSong, 6, -1 ) // Minuet of Forest
+ITEM_ROW(0xBC, 0x53, 0, 0x41, 0x0074, 0x0010, 0x00, 0x00, 0x06, ItemUpgrade_None, ItemEffect_GiveSong, 7, -1 ) // Bolero of Fire
+ITEM_ROW(0xBD, 0x53, 0, 0x41, 0x0075, 0x0010, 0x00, 0x05, 0x06, ItemUpgrade_None, ItemEffect_GiveSong, 8, -1 ) // Serenade of Water
+ITEM_ROW(0xBE, 0x53, 0, 0x41, 0x0076, 0x0010, 0x00, 0x04, 0x06, ItemUpgrade_None, ItemEffect_GiveSong, 9, -1 ) // Requiem of Spirit
+ITEM_ROW(0xBF, 0x53, 0, 0x41, 0x0077, 0x0010, 0x00, 0x02, 0x06, ItemUpgrade_None, ItemEffect_GiveSong, 10, -1) // Nocturne of Shadow
+ITEM_ROW(0xC0, 0x53, 0, 0x41, 0x0078, 0x0010, 0x00, 0x03, 0x06, ItemUpgrade_None, ItemEffect_GiveSong, 11, -1) // Prelude of Light
+
+ITEM_ROW(0xC1, 0x53, 0, 0x41, 0x00D4, 0x0005, 0x02, 0x01, 0x05, ItemUpgrade_None, ItemEffect_GiveSong, 12, -1) // Zelda's Lullaby
+ITEM_ROW(0xC2, 0x53, 0, 0x41, 0x00D2, 0x0005, 0x02, 0x00, 0x05, ItemUpgrade_None, ItemEffect_GiveSong, 13, -1) // Epona's Song
+ITEM_ROW(0xC3, 0x53, 0, 0x41, 0x00D1, 0x0005, 0x02, 0x02, 0x05, ItemUpgrade_None, ItemEffect_GiveSong, 14, -1) // Saria's Song
+ITEM_ROW(0xC4, 0x53, 0, 0x41, 0x00D3, 0x0005, 0x02, 0x04, 0x05, ItemUpgrade_None, ItemEffect_GiveSong, 15, -1) // Sun's Song
+ITEM_ROW(0xC5, 0x53, 0, 0x41, 0x00D5, 0x0005, 0x02, 0x05, 0x05, ItemUpgrade_None, ItemEffect_GiveSong, 16, -1) // Song of Time
+ITEM_ROW(0xC6, 0x53, 0, 0x41, 0x00D6, 0x0005, 0x02, 0x03, 0x05, ItemUpgrade_None, ItemEffect_GiveSong, 17, -1) // Song of Storms
+
+ITEM_ROW(0xC7, 0x53, 0, 0x41, 0x00F8, 0x00D1, 0x00, 0x00, 0x23, ItemUpgrade_None, ItemEffect_None,      3, -1) // Tycoon's Wallet //TODO?
+ITEM_ROW(0xC8, 0x53, 0, 0x14, 0x9099, 0x010B, 0x00, 0x00, 0x45, ItemUpgrade_None, ItemEffect_None,     -1, -1) // Redundant Letter Bottle
+ITEM_ROW(0xC9, 0x53, 0, 0x41, 0x0048, 0x00F3, 0x00, 0x00, 0x3E, ItemUpgrade_None, ItemEffect_BeanPack, -1, -1) // Magic Bean Pack
+// ITEM_ROW(0xCA, 0x53, 0, 0x41, 0x9003, 0x0193, 0x00, 0x00, 0x35, ItemUpgrade_None, give_triforce_piece, -1, -1) // Triforce piece
+
+ITEM_ROW(0xCB, 0x53, 0, 0x41, 0x0080, 0x019C, 0x00, 0x00, 0x88, ItemUpgrade_None, ItemEffect_GiveStone, 0x0004, -1) // Kokiri Emerald
+ITEM_ROW(0xCC, 0x53, 0, 0x41, 0x0081, 0x019D, 0x00, 0x00, 0x89, ItemUpgrade_None, ItemEffect_GiveStone, 0x0008, -1) // Goron Ruby
+ITEM_ROW(0xCD, 0x53, 0, 0x41, 0x0082, 0x019E, 0x00, 0x00, 0x8A, ItemUpgrade_None, ItemEffect_GiveStone, 0x0010, -1) // Zora Sapphire
+
+ITEM_ROW(0xCE, 0x53, 0, 0x41, 0x003E, 0x00BA, 0x01, 0x00, 0x0C, ItemUpgrade_None, ItemEffect_GiveMedallion, 0x0001, -1) // Forest Medallion
+ITEM_ROW(0xCF, 0x53, 0, 0x41, 0x003C, 0x00BA, 0x02, 0x00, 0x0D, ItemUpgrade_None, ItemEffect_GiveMedallion, 0x0002, -1) // Fire   Medallion
+ITEM_ROW(0xD0, 0x53, 0, 0x41, 0x003D, 0x00BA, 0x03, 0x00, 0x0E, ItemUpgrade_None, ItemEffect_GiveMedallion, 0x0004, -1) // Water  Medallion
+ITEM_ROW(0xD1, 0x53, 0, 0x41, 0x003F, 0x00BA, 0x04, 0x00, 0x0F, ItemUpgrade_None, ItemEffect_GiveMedallion, 0x0008, -1) // Spirit Medallion
+ITEM_ROW(0xD2, 0x53, 0, 0x41, 0x0041, 0x00BA, 0x05, 0x00, 0x10, ItemUpgrade_None, ItemEffect_GiveMedallion, 0x0010, -1) // Shadow Medallion
+ITEM_ROW(0xD3, 0x53, 0, 0x41, 0x0040, 0x00BA, 0x00, 0x00, 0x11, ItemUpgrade_None, ItemEffect_GiveMedallion, 0x0020, -1) // Light  Medallion
@@ -4,6 +4,7 @@
 #include "input.h"
 #include "models.h"
 #include "entrance.h"
+#include "profiler.h"
 
 #include "z3D/z3D.h"
 
@@ -27,9 +28,17 @@ void before_GlobalContext_Update(GlobalContext* globalCtx) {
         set_GlobalContext(globalCtx);
         rRandomizerInit = 1;
     }
+    PROFILE_BEGIN(overrideTick);
     ItemOverride_Update();
+    PROFILE_END(PROFILE_ITEM_OVERRIDE_UPDATE, overrideTick);
+
+    PROFILE_BEGIN(modelTick);
     Model_UpdateAll(globalCtx);
+    PROFILE_END(PROFILE_MODEL_UPDATE_ALL, modelTick);
+
+    PROFILE_BEGIN(inputTick);
     Input_Update();
+    PROFILE_END(PROFILE_INPUT_UPDATE, inputTick);
 }
 
 void after_GlobalContext_Update() {
@@ -1,6 +1,7 @@
 #include "z3D/z3D.h"
 #include "message.h"
 #include "dungeon_rewards.h"
+#include "profiler.h"
 #include <stddef.h>
 
 // These consts are filled in by the app
@@ -15,7 +16,7 @@ typedef const char* (*Message_GetText_proc)(void* param_1, u32 offset);
 #define Message_GetText_addr 0x2DF4B0
 #define Message_GetText ((Message_GetText_proc)Message_GetText_addr)
 
-const MessageEntry* Message_GetCustomEntry(void* param_1, u32 textId_) {
+static const MessageEntry* Message_FindCustomEntry(void* param_1, u32 textId_) {
     s32 start;
     s32 end;
 
@@ -36,6 +37,13 @@ const MessageEntry* Message_GetCustomEntry(void* param_1, u32 textId_) {
     return Message_GetEntry(param_1, textId);
 }
 
+const MessageEntry* Message_GetCustomEntry(void* param_1, u32 textId_) {
+    PROFILE_BEGIN(tick);
+    const MessageEntry* entry = Message_FindCustomEntry(param_1, textId_);
+    PROFILE_END(PROFILE_MESSAGE_GET_CUSTOM_ENTRY, tick);
+    return entry;
+}
+
 // compares offset to 0x500000 to detect custom
 const char* Message_GetCustomText(void* param_1, u32 offset) {
     return (offset > 0x500000) ? (char*)offset : Message_GetText(param_1, offset);
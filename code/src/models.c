@@ -5,6 +5,7 @@
 #include "objects.h"
 #include "dungeon_rewards.h"
 #include "custom_models.h"
+#include "profiler.h"
 #include <stddef.h>
 
 typedef void (*GlModel_MatrixCopy_proc)(GlModel* glModel, nn_math_MTX34* mtx);
@@ -35,8 +36,44 @@ typedef void (*Matrix_Multiply_proc)(nn_math_MTX34* dst, nn_math_MTX34* lhs, nn_
 #define Matrix_Multiply_addr 0x36C174
 #define Matrix_Multiply ((Matrix_Multiply_proc)Matrix_Multiply_addr)
 
-#define LOADEDMODELS_MAX 16
-Model ModelContext[LOADEDMODELS_MAX] = { 0 };
+#include "rHeap.h"
+
+static Model* rModelActiveList = NULL;
+static Model** rModelActiveTail = &rModelActiveList; // keeps spawn order for drawing
+static ModelPoolStats rModelPoolStats = { 0 };
+
+static u16 Model_Capacity(void) {
+    u16 classCapacity = rHeap_SmallCapacity(sizeof(Model));
+    return (classCapacity < MODELS_CAPACITY) ? classCapacity : MODELS_CAPACITY;
+}
+
+void Model_GetPoolStats(ModelPoolStats* stats) {
+    *stats = rModelPoolStats;
+    stats->capacity = Model_Capacity();
+}
+
+// Takes a block for a model from rHeap and appends it to the active list
+static Model* Model_Alloc(void) {
+    Model* model = NULL;
+
+    if (rModelPoolStats.active < Model_Capacity()) {
+        model = rHeap_AllocSmall(sizeof(Model));
+    }
+    if (model == NULL) {
+        rModelPoolStats.overflows++;
+        return NULL;
+    }
+
+    *model = (Model){ 0 };
+    *rModelActiveTail = model;
+    rModelActiveTail = &model->next;
+
+    rModelPoolStats.active++;
+    if (rModelPoolStats.active > rModelPoolStats.highWater) {
+        rModelPoolStats.highWater = rModelPoolStats.active;
+    }
+    return model;
+}
 
 void Model_SetAnim(Model* model, u32 objectAnimIdx) {
     void* cmabMan = ExtendedObject_GetCMABByIndex(model->info.objectId, objectAnimIdx);
@@ -121,31 +158,40 @@ void Model_Destroy(Model* model) {
     model->loaded = 0;
 }
 
+// Destroys the model linked at *link and gives its block back to rHeap
+static void Model_Release(Model** link) {
+    Model* model = *link;
+
+    Model_Destroy(model);
+    *link = model->next;
+    if (rModelActiveTail == &model->next) {
+        rModelActiveTail = link;
+    }
+
+    rHeap_Free(model);
+    rModelPoolStats.active--;
+}
+
 void Model_UpdateAll(GlobalContext* globalCtx) {
+    Model** link = &rModelActiveList;
     Model* model;
 
     Object_UpdateBank((ObjectContext*)&rExtendedObjectCtx);
 
-    for (s32 i = 0; i < LOADEDMODELS_MAX; ++i) {
-        model = &ModelContext[i];
-
-        // No actor, considered unused
-        if (model->actor == NULL) {
-            continue;
-        }
-
+    while ((model = *link) != NULL) {
         // Actor has been killed, destroy the model
         if (model->actor->update == NULL) {
-            Model_Destroy(model);
+            Model_Release(link);
             continue;
         }
 
         // Actor is alive, model has not been loaded yet
-        if ((model->actor != NULL) && (!model->loaded)) {
+        if (!model->loaded) {
             if (ExtendedObject_IsLoaded(&globalCtx->objectCtx, model->info.objectBankIdx)) {
                 Model_Init(model, globalCtx);
             }
         }
+        link = &model->next;
     }
 }
 
@@ -185,9 +231,11 @@ void Model_UpdateMatrix(Model* model) {
 
 void Model_Draw(Model* model) {
     if ((model->loaded) && (model->glModel != NULL)) {
+        PROFILE_BEGIN(tick);
         model->glModel->unk_AC = 1;
         Model_UpdateMatrix(model);
         GlModel_Draw(model->glModel, 0); //TODO is 0 always okay?
+        PROFILE_END(PROFILE_MODEL_DRAW, tick);
     }
 }
 
@@ -249,14 +297,7 @@ void Model_InfoLookup(Model* model, Actor* actor, GlobalContext* globalCtx, u16
 }
 
 void Model_Create(Model* model, GlobalContext* globalCtx) {
-    Model* newModel = NULL;
-
-    for (s32 i = 0; i < LOADEDMODELS_MAX; ++i) {
-        if ((ModelContext[i].actor == NULL) && (ModelContext[i].glModel == NULL)) {
-            newModel = &ModelContext[i];
-            break;
-        }
-    }
+    Model* newModel = Model_Alloc();
 
     if (newModel != NULL) {
         newModel->actor = model->actor;
@@ -309,26 +350,30 @@ void Model_SpawnByActor(Actor* actor, GlobalContext* globalCtx, u16 baseItemId)
 }
 
 void Model_DestroyByActor(Actor* actor) {
-    for (s32 i = 0; i < LOADEDMODELS_MAX; ++i) {
-        if (ModelContext[i].actor == actor) {
-            Model_Destroy(&ModelContext[i]);
+    Model** link = &rModelActiveList;
+
+    while (*link != NULL) {
+        if ((*link)->actor == actor) {
+            Model_Release(link);
+        } else {
+            link = &(*link)->next;
         }
     }
 }
 
 void Model_DestroyAll(void) {
-    for (s32 i = 0; i < LOADEDMODELS_MAX; ++i) {
-        Model_Destroy(&ModelContext[i]);
+    while (rModelActiveList != NULL) {
+        Model_Release(&rModelActiveList);
     }
 }
 
 s32 Model_DrawByActor(Actor* actor) {
     s32 actorDrawn = 0;
 
-    for (s32 i = 0; i < LOADEDMODELS_MAX; ++i) {
-        if (ModelContext[i].actor == actor) {
+    for (Model* model = rModelActiveList; model != NULL; model = model->next) {
+        if (model->actor == actor) {
             actorDrawn = 1;
-            Model_Draw(&ModelContext[i]);
+            Model_Draw(model);
         }
     }
     return actorDrawn;
@@ -10,14 +10,27 @@ typedef struct {
     s32 objectMeshId; //or anim frame
 } ObjectInfo;
 
-typedef struct {
+typedef struct Model {
     Actor* actor;
     ObjectInfo info;
     u32 loaded;
     GlModel* glModel;
     f32 scale;
+    struct Model* next; // link in the active list
 } Model;
 
+// Number of models that can be alive at once, fewer if rHeap's class that fits
+// a Model has fewer blocks
+#define MODELS_CAPACITY 48
+
+typedef struct {
+    u16 capacity;
+    u16 active;
+    u16 highWater;
+    u16 overflows; // spawns dropped because the pool was full
+} ModelPoolStats;
+
+void Model_GetPoolStats(ModelPoolStats* stats);
 void Model_UpdateAll(GlobalContext* globalCtx);
 
 void Model_SpawnByActor(Actor* actor, GlobalContext* globalCtx, u16 baseItemId);
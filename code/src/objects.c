@@ -4,24 +4,89 @@
 
 ExtendedObjectContext rExtendedObjectCtx = { 0 };
 
+// Open-addressing map from objectId to extended bank slot. Objects only get a slot through
+// ExtendedObject_Spawn and only lose it through ExtendedObject_Clear, which keep the map in
+// sync, so it is the whole truth about which objects are spawned. Object_UpdateBank only
+// flips the sign of a slot's id once the object is loaded.
+#define OBJECT_SLOT_MAP_SIZE 64 // power of two, more than twice OBJECT_EXCHANGE_BANK_MAX
+#define OBJECT_SLOT_EMPTY -1
+
+typedef struct {
+    s16 objectId;
+    s16 slot;
+} ObjectSlotEntry;
+
+static ObjectSlotEntry rObjectSlotMap[OBJECT_SLOT_MAP_SIZE];
+static u8 rObjectSlotMapReady = 0; // the map is all zeroes until the first reset
+
+static void ObjectSlotMap_Reset(void) {
+    s32 i;
+    for (i = 0; i < OBJECT_SLOT_MAP_SIZE; ++i) {
+        rObjectSlotMap[i].objectId = OBJECT_SLOT_EMPTY;
+        rObjectSlotMap[i].slot = OBJECT_SLOT_EMPTY;
+    }
+    rObjectSlotMapReady = 1;
+}
+
+static u32 ObjectSlotMap_Hash(s16 objectId) {
+    return ((u32)objectId * 0x9E3779B1) >> 26; // top 6 bits select one of the 64 buckets
+}
+
+static void ObjectSlotMap_Insert(s16 objectId, s32 slot) {
+    u32 i = ObjectSlotMap_Hash(objectId);
+    u32 probes;
+
+    if (!rObjectSlotMapReady) {
+        ObjectSlotMap_Reset();
+    }
+    for (probes = 0; probes < OBJECT_SLOT_MAP_SIZE; ++probes) {
+        if (rObjectSlotMap[i].objectId == OBJECT_SLOT_EMPTY || rObjectSlotMap[i].objectId == objectId) {
+            rObjectSlotMap[i].objectId = objectId;
+            rObjectSlotMap[i].slot = slot;
+            return;
+        }
+        i = (i + 1) & (OBJECT_SLOT_MAP_SIZE - 1);
+    }
+}
+
+// Returns the extended slot holding objectId, or -1 if it isn't spawned
+static s32 ObjectSlotMap_Find(s16 objectId) {
+    u32 i = ObjectSlotMap_Hash(objectId);
+    u32 probes;
+
+    if (!rObjectSlotMapReady) {
+        return -1;
+    }
+    for (probes = 0; probes < OBJECT_SLOT_MAP_SIZE; ++probes) {
+        if (rObjectSlotMap[i].objectId == objectId) {
+            return rObjectSlotMap[i].slot;
+        }
+        // Entries are never removed one at a time, so the probe chain ends at the first gap
+        if (rObjectSlotMap[i].objectId == OBJECT_SLOT_EMPTY) {
+            return -1;
+        }
+        i = (i + 1) & (OBJECT_SLOT_MAP_SIZE - 1);
+    }
+    return -1;
+}
+
 s32 ExtendedObject_Spawn(ObjectContext* objectCtx, s16 objectId) {
-    return Object_Spawn(&rExtendedObjectCtx, objectId) + OBJECT_EXCHANGE_BANK_MAX;
+    s32 slot = Object_Spawn(&rExtendedObjectCtx, objectId);
+    ObjectSlotMap_Insert(objectId, slot);
+    return slot + OBJECT_EXCHANGE_BANK_MAX;
 }
 
 void ExtendedObject_Clear(GlobalContext* globalCtx, ObjectContext* objectCtx) {
     Object_Clear(globalCtx, objectCtx);
     Object_Clear(globalCtx, &rExtendedObjectCtx);
+    ObjectSlotMap_Reset();
 }
 
 s32 ExtendedObject_GetIndex(ObjectContext* objectCtx, s16 objectId) {
     s32 index = Object_GetIndex(objectCtx, objectId);
     if (index < 0) {
-        s32 i;
-        for (i = 0; i < OBJECT_EXCHANGE_BANK_MAX; ++i) {
-            s32 id = rExtendedObjectCtx.status[i].id;
-            id = (id < 0 ? -id : id);
-            if (id == objectId) return i + OBJECT_EXCHANGE_BANK_MAX;
-        }
+        s32 slot = ObjectSlotMap_Find(objectId);
+        if (slot >= 0) return slot + OBJECT_EXCHANGE_BANK_MAX;
     }
     return index;
 }
@@ -33,13 +98,8 @@ s32 ExtendedObject_IsLoaded(ObjectContext* objectCtx, s16 bankIndex) {
 }
 
 ObjectStatus* ExtendedObject_GetStatus(s16 objectId) {
-    s32 i;
-    for (i = 0; i < rExtendedObjectCtx.num; ++i) {
-        s32 id = rExtendedObjectCtx.status[i].id;
-        id = (id < 0 ? -id : id);
-        if (id == objectId) return &rExtendedObjectCtx.status[i];
-    }
-    return NULL;
+    s32 slot = ObjectSlotMap_Find(objectId);
+    return (slot >= 0) ? &rExtendedObjectCtx.status[slot] : NULL;
 }
 
 void* ExtendedObject_GetCMABByIndex(s16 objectId, u32 objectAnimIdx) {
@@ -0,0 +1,113 @@
+#ifndef _OVERRIDE_TABLE_H_
+#define _OVERRIDE_TABLE_H_
+
+// Scene-bucketed override table, encoded by the app and decoded by the patch.
+// Both sides include this header so the layout can't drift apart.
+
+#include "item_override.h"
+
+#define OVERRIDE_SCENES_MAX 256
+#define OVERRIDE_ENTRIES_MAX 512
+
+// One override without its scene, which is implied by the bucket holding it
+typedef struct {
+    u8 flag;
+    u8 type;
+    u16 value; // low byte itemId, high byte looksLikeItemId
+} PackedOverride;
+
+typedef struct {
+    // Overrides for scene s are entries[sceneStart[s]] up to entries[sceneStart[s + 1]],
+    // sorted by flag then type like ItemOverride_Key::all
+    u16 sceneStart[OVERRIDE_SCENES_MAX + 1];
+    PackedOverride entries[OVERRIDE_ENTRIES_MAX];
+} OverrideTable;
+
+static inline u32 OverrideTable_Count(const OverrideTable* table) {
+    return table->sceneStart[OVERRIDE_SCENES_MAX];
+}
+
+// Returns 0 if the override doesn't fit in a packed entry
+static inline s32 OverrideTable_Pack(ItemOverride override, PackedOverride* packed) {
+    if (override.value.itemId > 0xFF || override.value.player != 0) {
+        return 0;
+    }
+    packed->flag = override.key.flag;
+    packed->type = override.key.type;
+    packed->value = override.value.itemId | (override.value.looksLikeItemId << 8);
+    return 1;
+}
+
+static inline ItemOverride OverrideTable_Unpack(u8 scene, PackedOverride packed) {
+    ItemOverride override;
+    override.key.all = 0;
+    override.key.scene = scene;
+    override.key.type = packed.type;
+    override.key.flag = packed.flag;
+    override.value.all = 0;
+    override.value.itemId = packed.value & 0xFF;
+    override.value.looksLikeItemId = packed.value >> 8;
+    return override;
+}
+
+// Fills table from overrides sorted by key.all, returns 0 if they don't fit
+static inline s32 OverrideTable_Encode(OverrideTable* table, const ItemOverride* overrides, u32 count) {
+    u32 scene;
+    u32 i;
+
+    if (count > OVERRIDE_ENTRIES_MAX) {
+        return 0;
+    }
+
+    // Count per scene, then turn the counts into bucket offsets
+    for (scene = 0; scene <= OVERRIDE_SCENES_MAX; ++scene) {
+        table->sceneStart[scene] = 0;
+    }
+    for (i = 0; i < count; ++i) {
+        table->sceneStart[overrides[i].key.scene + 1]++;
+    }
+    for (scene = 0; scene < OVERRIDE_SCENES_MAX; ++scene) {
+        table->sceneStart[scene + 1] += table->sceneStart[scene];
+    }
+
+    // Stable placement keeps each bucket in key order; sceneStart[s] is used as the
+    // write cursor for bucket s and ends up at the start of bucket s + 1
+    for (i = 0; i < count; ++i) {
+        u8 s = overrides[i].key.scene;
+        if (!OverrideTable_Pack(overrides[i], &table->entries[table->sceneStart[s]])) {
+            return 0;
+        }
+        table->sceneStart[s]++;
+    }
+    for (scene = OVERRIDE_SCENES_MAX; scene > 0; --scene) {
+        table->sceneStart[scene] = table->sceneStart[scene - 1];
+    }
+    table->sceneStart[0] = 0;
+    return 1;
+}
+
+// Returns an override with key.all == 0 if there is none for key
+static inline ItemOverride OverrideTable_Find(const OverrideTable* table, ItemOverride_Key key) {
+    s32 start = table->sceneStart[key.scene];
+    s32 end = table->sceneStart[key.scene + 1] - 1;
+    u16 search = (key.flag << 8) | key.type;
+    ItemOverride none;
+
+    while (start <= end) {
+        s32 midIdx = (start + end) / 2;
+        PackedOverride mid = table->entries[midIdx];
+        u16 midSearch = (mid.flag << 8) | mid.type;
+        if (search < midSearch) {
+            end = midIdx - 1;
+        } else if (search > midSearch) {
+            start = midIdx + 1;
+        } else {
+            return OverrideTable_Unpack(key.scene, mid);
+        }
+    }
+    none.key.all = 0;
+    none.value.all = 0;
+    return none;
+}
+
+#endif //_OVERRIDE_TABLE_H_
@@ -0,0 +1,64 @@
+#include "profiler.h"
+#include "3ds/svc.h"
+
+#ifdef ENABLE_PROFILER
+
+typedef struct {
+    u32 samples[PROFILE_WINDOW];
+    u32 next;
+    u32 count;
+} ProfileWindow;
+
+static ProfileWindow rProfileWindows[PROFILE_MAX] = { 0 };
+
+const char* const ProfileSectionNames[PROFILE_MAX] = {
+    "ItemOverride_Update",
+    "Model_UpdateAll",
+    "Input_Update",
+    "ItemOverride_GetItem",
+    "Message_GetCustomEntry",
+    "Model_Draw",
+};
+
+u64 Profile_Begin(void) {
+    return svcGetSystemTick();
+}
+
+void Profile_End(ProfileSection section, u64 startTick) {
+    Profile_Record(section, (u32)(svcGetSystemTick() - startTick));
+}
+
+void Profile_Record(ProfileSection section, u32 ticks) {
+    ProfileWindow* window = &rProfileWindows[section];
+
+    window->samples[window->next] = ticks;
+    window->next = (window->next + 1) % PROFILE_WINDOW;
+    if (window->count < PROFILE_WINDOW) {
+        window->count++;
+    }
+}
+
+// Recording only writes the sample and moves the ring, folding the window is left to the reader
+void Profile_GetSummary(ProfileSection section, ProfileSummary* summary) {
+    ProfileWindow* window = &rProfileWindows[section];
+    u64 total = 0;
+
+    summary->min = 0;
+    summary->avg = 0;
+    summary->max = 0;
+    summary->count = window->count;
+    if (window->count == 0) {
+        return;
+    }
+
+    summary->min = window->samples[0];
+    for (u32 i = 0; i < window->count; ++i) {
+        u32 ticks = window->samples[i];
+        total += ticks;
+        if (ticks < summary->min) summary->min = ticks;
+        if (ticks > summary->max) summary->max = ticks;
+    }
+    summary->avg = (u32)(total / window->count);
+}
+
+#endif //ENABLE_PROFILER
@@ -0,0 +1,45 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include "z3D/z3D.h"
+#include "3ds/types.h"
+
+typedef enum {
+    PROFILE_ITEM_OVERRIDE_UPDATE,
+    PROFILE_MODEL_UPDATE_ALL,
+    PROFILE_INPUT_UPDATE,
+    PROFILE_ITEM_OVERRIDE_GET_ITEM,
+    PROFILE_MESSAGE_GET_CUSTOM_ENTRY,
+    PROFILE_MODEL_DRAW,
+    PROFILE_MAX,
+} ProfileSection;
+
+// Number of most recent samples each section keeps for its min/avg/max
+#define PROFILE_WINDOW 64
+
+typedef struct {
+    u32 min;
+    u32 avg;
+    u32 max;
+    u32 count; // samples in the window
+} ProfileSummary;
+
+// The profiler is only built with "make profiler=1". Otherwise these macros
+// compile to nothing and the hooks aren't timed.
+#ifdef ENABLE_PROFILER
+#define PROFILE_BEGIN(tick) u64 tick = Profile_Begin()
+#define PROFILE_END(section, tick) Profile_End(section, tick)
+#else
+#define PROFILE_BEGIN(tick)
+#define PROFILE_END(section, tick)
+#endif
+
+extern const char* const ProfileSectionNames[PROFILE_MAX];
+
+u64 Profile_Begin(void);
+void Profile_End(ProfileSection section, u64 startTick);
+// Adds one sample in ticks, kept separate from the tick source
+void Profile_Record(ProfileSection section, u32 ticks);
+void Profile_GetSummary(ProfileSection section, ProfileSummary* summary);
+
+#endif //_PROFILER_H_
@@ -1,20 +1,146 @@
-#include "rHeap.h"
-#include <stddef.h>
-
-#include "z3D/z3D.h"
-
-char rHeap[sizeof(Actor) + 16]; //TODO: Increase if needed
-void* rHeap_Next = NULL;
-
-void rHeap_Init(void) {
-    rHeap_Next = &rHeap[0];
-}
-
-void* rHeap_Alloc(u32 bytes) {
-    u32 rem = bytes % 16;
-    if (rem) bytes += 16 - rem;
-
-    void* result = rHeap_Next;
-    rHeap_Next = (char*)rHeap_Next + bytes;
-    return result;
-}
+#include "rHeap.h"
+#include <stddef.h>
+
+#include "z3D/z3D.h"
+
+#define RHEAP_ALIGN 16
+#define RHEAP_ROUND(bytes) (((bytes) + RHEAP_ALIGN - 1) & ~(RHEAP_ALIGN - 1))
+
+// Bump region for data allocated once in Randomizer_Init, sized for its only user, the dummy actor
+#define RHEAP_BUMP_SIZE RHEAP_ROUND(sizeof(Actor))
+
+typedef struct rHeapBlock {
+    struct rHeapBlock* next;
+} rHeapBlock;
+
+typedef struct {
+    u16 blockSize;
+    u16 capacity;
+    char* start;
+    rHeapBlock* freeList;
+    u16 used;
+    u16 peak;
+} rHeapClass;
+
+// Smallest first. The 32 byte class has room for every model, the biggest runtime user.
+static const u16 rHeapClassBlockSize[RHEAP_SMALL_CLASSES] = { 16, 32, 64, 128 };
+static const u16 rHeapClassCapacity[RHEAP_SMALL_CLASSES] = { 32, 48, 8, 4 };
+
+#define RHEAP_SMALL_SIZE (16 * 32 + 32 * 48 + 64 * 8 + 128 * 4)
+
+static char rHeap[RHEAP_BUMP_SIZE + RHEAP_SMALL_SIZE] __attribute__((aligned(RHEAP_ALIGN)));
+static char* rHeap_Next = NULL;
+static char* rHeap_BumpEnd = NULL;
+static rHeapClass rHeapClasses[RHEAP_SMALL_CLASSES];
+static u32 rHeapOverflows = 0;
+static u32 rHeapBadFrees = 0;
+
+void rHeap_Init(void) {
+    char* classStart = &rHeap[RHEAP_BUMP_SIZE];
+
+    rHeap_Next = &rHeap[0];
+    rHeap_BumpEnd = classStart;
+
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        rHeapClass* cls = &rHeapClasses[c];
+        cls->blockSize = rHeapClassBlockSize[c];
+        cls->capacity = rHeapClassCapacity[c];
+        cls->start = classStart;
+        cls->freeList = NULL;
+        cls->used = 0;
+        cls->peak = 0;
+
+        for (s32 i = cls->capacity - 1; i >= 0; --i) {
+            rHeapBlock* block = (rHeapBlock*)(cls->start + i * cls->blockSize);
+            block->next = cls->freeList;
+            cls->freeList = block;
+        }
+        classStart += cls->blockSize * cls->capacity;
+    }
+    rHeapOverflows = 0;
+    rHeapBadFrees = 0;
+}
+
+void* rHeap_Alloc(u32 bytes) {
+    u32 rem = bytes % RHEAP_ALIGN;
+    if (rem) bytes += RHEAP_ALIGN - rem;
+
+    if (bytes > (u32)(rHeap_BumpEnd - rHeap_Next)) {
+        rHeapOverflows++;
+        return NULL;
+    }
+
+    void* result = rHeap_Next;
+    rHeap_Next += bytes;
+    return result;
+}
+
+void* rHeap_AllocSmall(u32 bytes) {
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        rHeapClass* cls = &rHeapClasses[c];
+        if (bytes > cls->blockSize) {
+            continue;
+        }
+        // Don't spill into a bigger class, a full class means it needs resizing
+        if (cls->freeList == NULL) {
+            break;
+        }
+
+        rHeapBlock* block = cls->freeList;
+        cls->freeList = block->next;
+        cls->used++;
+        if (cls->used > cls->peak) {
+            cls->peak = cls->used;
+        }
+        return block;
+    }
+    rHeapOverflows++;
+    return NULL;
+}
+
+void rHeap_Free(void* ptr) {
+    char* p = ptr;
+
+    if (ptr == NULL) {
+        return;
+    }
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        rHeapClass* cls = &rHeapClasses[c];
+        char* end = cls->start + cls->blockSize * cls->capacity;
+        if (p < cls->start || p >= end) {
+            continue;
+        }
+        if ((p - cls->start) % cls->blockSize != 0) {
+            break;
+        }
+
+        rHeapBlock* block = ptr;
+        block->next = cls->freeList;
+        cls->freeList = block;
+        cls->used--;
+        return;
+    }
+    rHeapBadFrees++;
+}
+
+u16 rHeap_SmallCapacity(u32 bytes) {
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        if (bytes <= rHeapClassBlockSize[c]) {
+            return rHeapClassCapacity[c];
+        }
+    }
+    return 0;
+}
+
+void rHeap_GetStats(rHeapStats* stats) {
+    stats->bumpUsed = rHeap_Next - &rHeap[0];
+    stats->bumpSize = rHeap_BumpEnd - &rHeap[0];
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        stats->classBlockSize[c] = rHeapClasses[c].blockSize;
+        stats->classUsed[c] = rHeapClasses[c].used;
+        stats->classPeak[c] = rHeapClasses[c].peak;
+        stats->classCapacity[c] = rHeapClasses[c].capacity;
+    }
+    stats->overflows = rHeapOverflows;
+    stats->badFrees = rHeapBadFrees;
+}
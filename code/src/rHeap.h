@@ -1,11 +1,32 @@
-#ifndef _RHEAP_H_
-#define _RHEAP_H_
-
-#include "z3D/z3D.h"
-
-#define ARR_SIZE(a) (sizeof(a) / sizeof(a[0]))
-
-void rHeap_Init(void);
-void* rHeap_Alloc(u32 bytes);
-
-#endif //_RHEAP_H_
+#ifndef _RHEAP_H_
+#define _RHEAP_H_
+
+#include "z3D/z3D.h"
+
+#define ARR_SIZE(a) (sizeof(a) / sizeof(a[0]))
+
+// Size classes for rHeap_AllocSmall, each backed by a fixed number of blocks
+#define RHEAP_SMALL_CLASSES 4
+
+typedef struct {
+    u32 bumpUsed;
+    u32 bumpSize;
+    u16 classBlockSize[RHEAP_SMALL_CLASSES];
+    u16 classUsed[RHEAP_SMALL_CLASSES];
+    u16 classPeak[RHEAP_SMALL_CLASSES];
+    u16 classCapacity[RHEAP_SMALL_CLASSES];
+    u32 overflows;   // allocations refused because their region was full
+    u32 badFrees;    // frees of pointers that don't belong to a small class
+} rHeapStats;
+
+void rHeap_Init(void);
+// Init-time allocation that is never freed, returns NULL when the region is full
+void* rHeap_Alloc(u32 bytes);
+// Runtime allocation from the smallest size class that fits, returns NULL when full
+void* rHeap_AllocSmall(u32 bytes);
+void rHeap_Free(void* ptr);
+// Number of blocks in the class rHeap_AllocSmall uses for this size, 0 if none fits
+u16 rHeap_SmallCapacity(u32 bytes);
+void rHeap_GetStats(rHeapStats* stats);
+
+#endif //_RHEAP_H_
@@ -0,0 +1,185 @@
+// Checks the glyph strip blit in draw.c against the per-pixel drawing it replaced,
+// and that clears and flushes only cover what was drawn
+#include "test.h"
+#include "draw.c"
+
+// What draw.c needs from the system
+typedef struct {
+    const u8* addr;
+    u32 size;
+} Flush;
+
+static Flush flushes[8];
+static u32 flushCount = 0;
+
+Result svcFlushProcessDataCache(Handle process, void const* addr, u32 size) {
+    if (flushCount < 8) {
+        flushes[flushCount] = (Flush){ addr, size };
+    }
+    flushCount++;
+    return 0;
+}
+void RecursiveLock_Init(RecursiveLock* lock) {}
+void RecursiveLock_Lock(RecursiveLock* lock) {}
+void RecursiveLock_Unlock(RecursiveLock* lock) {}
+int vsnprintf_(char* buffer, size_t count, const char* format, va_list va) {
+    buffer[0] = '\0';
+    return 0;
+}
+
+#define BACKGROUND 0x5A
+
+static u8 bottomBuffers[2][FB_BOTTOM_SIZE];
+static u8 topBuffers[4][FB_TOP_SIZE];
+static u8 expected[FB_TOP_SIZE];
+
+static void UseTestFramebuffers(void) {
+    Draw_SetupFramebuffer();
+    FRAMEBUFFER[0] = bottomBuffers[0];
+    FRAMEBUFFER[1] = bottomBuffers[1];
+    for (u32 i = 0; i < 4; i++) {
+        FRAMEBUFFER[2 + i] = topBuffers[i];
+    }
+}
+
+// The old Draw_DrawCharacter, minus the write before the framebuffer at posX 0
+static void DrawReferenceCharacter(u8* fb, u32 screenHeight, u32 posX, u32 posY, u32 color, char character) {
+    for (s32 y = 0; y < 10; y++) {
+        const char charPos = ascii_font[(u8)character * 10 + y];
+
+        for (s32 x = 6; x >= 1; x--) {
+            if ((s32)posX + (5 - x) < 0) {
+                continue;
+            }
+            const u32 screenPos = (posX * screenHeight + (screenHeight - y - posY - 1)) + (5 - x) * screenHeight;
+            const u32 pixelColor = ((charPos >> x) & 1) ? color : COLOR_BLACK;
+
+            fb[screenPos * 3] = (pixelColor) & 0xFF;
+            fb[screenPos * 3 + 1] = (pixelColor >> 8) & 0xFF;
+            fb[screenPos * 3 + 2] = (pixelColor >> 16) & 0xFF;
+        }
+    }
+}
+
+static void CheckCharacter(u32 posX, u32 posY, u32 color, char character) {
+    memset(bottomBuffers, BACKGROUND, sizeof(bottomBuffers));
+    memset(expected, BACKGROUND, FB_BOTTOM_SIZE);
+    Draw_DrawCharacter(posX, posY, color, character);
+    DrawReferenceCharacter(expected, SCREEN_BOT_HEIGHT, posX, posY, color, character);
+    CHECK(memcmp(bottomBuffers[0], expected, FB_BOTTOM_SIZE) == 0);
+    CHECK(memcmp(bottomBuffers[1], expected, FB_BOTTOM_SIZE) == 0);
+}
+
+static void CheckCharacterTop(u32 posX, u32 posY, u32 color, char character) {
+    memset(topBuffers, BACKGROUND, sizeof(topBuffers));
+    memset(expected, BACKGROUND, FB_TOP_SIZE);
+    Draw_DrawCharacterTop(posX, posY, color, character);
+    DrawReferenceCharacter(expected, SCREEN_TOP_HEIGHT, posX, posY, color, character);
+    for (u32 i = 0; i < 4; i++) {
+        CHECK(memcmp(topBuffers[i], expected, FB_TOP_SIZE) == 0);
+    }
+}
+
+// Bytes from the start of column x to row y, rows are stored bottom to top
+static u32 PixelOffset(u32 screenHeight, u32 x, u32 y) {
+    return (x * screenHeight + screenHeight - 1 - y) * 3;
+}
+
+static bool ColumnsAreClear(const u8* fb, u32 left, u32 right) {
+    for (u32 i = left * SCREEN_BOT_HEIGHT * 3; i < right * SCREEN_BOT_HEIGHT * 3; i++) {
+        if (fb[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void CheckFlushedColumns(u32 left, u32 right) {
+    const u32 columnSize = SCREEN_BOT_HEIGHT * 3;
+    flushCount = 0;
+    Draw_FlushFramebuffer();
+    CHECK(flushCount == 2);
+    for (u32 fb = 0; fb < 2 && fb < flushCount; fb++) {
+        CHECK(flushes[fb].addr == bottomBuffers[fb] + left * columnSize);
+        CHECK(flushes[fb].size == (right - left) * columnSize);
+    }
+}
+
+static void CheckNothingFlushed(void) {
+    flushCount = 0;
+    Draw_FlushFramebuffer();
+    CHECK(flushCount == 0);
+}
+
+static void CheckDirtyRects(void) {
+    UseTestFramebuffers();
+    memset(bottomBuffers, BACKGROUND, sizeof(bottomBuffers));
+
+    // The screens start fully dirty, then a flush leaves nothing to do
+    CheckFlushedColumns(0, SCREEN_BOT_WIDTH);
+    CheckNothingFlushed();
+
+    // Two characters flush one span covering both, including the column left of each
+    Draw_DrawCharacter(30, 40, COLOR_WHITE, 'A');
+    Draw_DrawCharacter(100, 200, COLOR_WHITE, 'B');
+    CheckFlushedColumns(29, 100 + FONT_WIDTH - 1);
+    CheckNothingFlushed();
+
+    // The first clear after setup blacks out everything and flushes it
+    Draw_ClearFramebuffer();
+    CHECK(ColumnsAreClear(bottomBuffers[0], 0, SCREEN_BOT_WIDTH));
+    CHECK(ColumnsAreClear(bottomBuffers[1], 0, SCREEN_BOT_WIDTH));
+    CheckFlushedColumns(0, SCREEN_BOT_WIDTH);
+
+    // Later clears only touch the rows and columns drawn since the last one
+    memset(bottomBuffers, BACKGROUND, sizeof(bottomBuffers));
+    Draw_DrawCharacter(50, 60, COLOR_WHITE, 'C');
+    Draw_DrawCharacter(62, 80, COLOR_WHITE, 'D');
+    CheckFlushedColumns(49, 62 + FONT_WIDTH - 1);
+    Draw_ClearFramebuffer();
+    for (u32 fb = 0; fb < 2; fb++) {
+        const u8* buffer = bottomBuffers[fb];
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 49, 60)] == 0);
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 62 + FONT_WIDTH - 2, 80 + FONT_HEIGHT - 1)] == 0);
+        // between the two characters, inside the merged rectangle
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 58, 75)] == 0);
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 48, 60)] == BACKGROUND);
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 62 + FONT_WIDTH - 1, 60)] == BACKGROUND);
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 55, 59)] == BACKGROUND);
+        CHECK(buffer[PixelOffset(SCREEN_BOT_HEIGHT, 55, 80 + FONT_HEIGHT)] == BACKGROUND);
+    }
+    CheckFlushedColumns(49, 62 + FONT_WIDTH - 1);
+
+    // Nothing drawn, nothing to clear
+    memset(bottomBuffers, BACKGROUND, sizeof(bottomBuffers));
+    Draw_ClearFramebuffer();
+    CHECK(bottomBuffers[0][PixelOffset(SCREEN_BOT_HEIGHT, 55, 70)] == BACKGROUND);
+    CheckNothingFlushed();
+
+    // A fill changes the whole screen, but a black fill leaves nothing to clear
+    Draw_FillFramebuffer(0);
+    CheckFlushedColumns(0, SCREEN_BOT_WIDTH);
+    memset(bottomBuffers, BACKGROUND, sizeof(bottomBuffers));
+    Draw_ClearFramebuffer();
+    CHECK(bottomBuffers[1][PixelOffset(SCREEN_BOT_HEIGHT, 0, 0)] == BACKGROUND);
+    CheckNothingFlushed();
+}
+
+int main(void) {
+    UseTestFramebuffers();
+
+    for (u32 character = 0; character < 256; character++) {
+        CheckCharacter(10, 20, COLOR_WHITE, (char)character);
+    }
+    CheckCharacter(0, 0, COLOR_RED, 'A');
+    CheckCharacter(1, 0, COLOR_TITLE, 'W');
+    CheckCharacter(SCREEN_BOT_WIDTH - FONT_WIDTH + 1, SCREEN_BOT_HEIGHT - FONT_HEIGHT, COLOR_GREEN, '#');
+
+    CheckCharacterTop(0, 0, COLOR_WHITE, 'M');
+    CheckCharacterTop(123, 45, COLOR_RED, 'g');
+    CheckCharacterTop(SCREEN_TOP_WIDTH - FONT_WIDTH + 1, SCREEN_TOP_HEIGHT - FONT_HEIGHT, COLOR_TITLE, '@');
+
+    CheckDirtyRects();
+
+    return TEST_RESULT();
+}
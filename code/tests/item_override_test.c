@@ -0,0 +1,254 @@
+// Checks the pending item queue in item_override.c against a plain array model
+#include "test.h"
+#include "z3D/z3D.h"
+#include <string.h>
+
+// Event flags kept in memory instead of the save
+#undef EventCheck
+#undef EventSet
+#define EventCheck Fake_EventCheck
+#define EventSet Fake_EventSet
+
+static u8 fakeEvents[0x100];
+
+static u32 Fake_EventCheck(u32 flag) {
+    return fakeEvents[flag];
+}
+
+static void Fake_EventSet(u32 flag) {
+    fakeEvents[flag] = 1;
+}
+
+#include "item_override.c"
+
+// What item_override.c needs from the rest of the patch
+static GlobalContext fakeGlobalContext;
+GlobalContext* gGlobalContext = &fakeGlobalContext;
+SettingsContext gSettingsContext;
+void* rHeap_Alloc(u32 bytes) {
+    static Actor actor;
+    return &actor;
+}
+void CustomModel_EditHeartContainerToDoubleDefense(void* heartContainerCMB) {}
+void CustomModel_SetOcarinaToRGBA565(void* fairyOcarinaCMB) {}
+void CustomModel_Update(void) {}
+void* ExtendedObject_GetCMABByIndex(s16 objectId, u32 objectAnimIdx) {
+    return NULL;
+}
+void IceTrap_Push(void) {}
+void IceTrap_Give(void) {}
+u32 IceTrap_IsPending(void) {
+    return 0;
+}
+void IceTrap_Update(void) {}
+u16 ItemTable_ResolveUpgrades(u16 itemId) {
+    return itemId;
+}
+ItemRow* ItemTable_GetItemRow(u16 itemId) {
+    return NULL;
+}
+void ItemTable_CallEffect(ItemRow* itemRow) {}
+
+static ItemOverride MakeOverride(u8 scene, u8 flag, u8 itemId) {
+    ItemOverride override = { 0 };
+    override.key.scene = scene;
+    override.key.type = OVR_BASE_ITEM;
+    override.key.flag = flag;
+    override.value.itemId = itemId;
+    return override;
+}
+
+static u32 Queued(void) {
+    PendingOverrideStats stats;
+    ItemOverride_GetPendingStats(&stats);
+    return stats.queued;
+}
+
+static void EmptyQueue(void) {
+    while (ItemOverride_PeekPendingOverride().key.all != 0) {
+        ItemOverride_PopPendingOverride();
+    }
+}
+
+// Random pushes and pops, with few enough keys that duplicates and a full queue both happen
+static void CheckAgainstModel(void) {
+    u32 model[PENDING_OVERRIDES_MAX];
+    u32 modelCount = 0;
+    u32 random = 12345;
+
+    for (u32 step = 0; step < 20000; ++step) {
+        random = random * 1103515245 + 12345;
+        u32 roll = (random >> 16) % 100;
+
+        if (roll < 60) {
+            ItemOverride override = MakeOverride(1, (random >> 8) % 24, 0x42);
+            s32 duplicate = 0;
+            for (u32 i = 0; i < modelCount; ++i) {
+                duplicate |= (model[i] == override.key.all);
+            }
+
+            s32 pushed = ItemOverride_PushPendingOverride(override);
+            if (duplicate) {
+                CHECK(pushed == 1);
+            } else if (modelCount == PENDING_OVERRIDES_MAX) {
+                CHECK(pushed == 0);
+            } else {
+                CHECK(pushed == 1);
+                model[modelCount++] = override.key.all;
+            }
+        } else {
+            ItemOverride_PopPendingOverride();
+            if (modelCount > 0) {
+                memmove(&model[0], &model[1], (modelCount - 1) * sizeof(model[0]));
+                modelCount--;
+            }
+        }
+
+        CHECK(Queued() == modelCount);
+        CHECK(ItemOverride_PeekPendingOverride().key.all == (modelCount > 0 ? model[0] : 0));
+    }
+    EmptyQueue();
+}
+
+static void CheckFullQueue(void) {
+    PendingOverrideStats stats;
+    ItemOverride_GetPendingStats(&stats);
+    const u32 overflows = stats.overflows;
+
+    for (u32 i = 0; i < PENDING_OVERRIDES_MAX; ++i) {
+        CHECK(ItemOverride_PushPendingOverride(MakeOverride(2, i, 0x42)) == 1);
+    }
+    // A duplicate of a queued item still counts as queued, a new one is refused
+    // and left to the caller, so it isn't counted as dropped
+    CHECK(ItemOverride_PushPendingOverride(MakeOverride(2, 0, 0x42)) == 1);
+    CHECK(ItemOverride_PushPendingOverride(MakeOverride(2, PENDING_OVERRIDES_MAX, 0x42)) == 0);
+
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.queued == PENDING_OVERRIDES_MAX);
+    CHECK(stats.highWater == PENDING_OVERRIDES_MAX);
+    CHECK(stats.overflows == overflows);
+
+    // Items come out in the order they went in
+    for (u32 i = 0; i < PENDING_OVERRIDES_MAX; ++i) {
+        CHECK(ItemOverride_PeekPendingOverride().key.flag == i);
+        ItemOverride_PopPendingOverride();
+    }
+    CHECK(ItemOverride_PeekPendingOverride().key.all == 0);
+}
+
+static void CheckZeldasLetter(void) {
+    ItemOverride letter = MakeOverride(0x4A, 0x0B, 0x0E);
+    CHECK(OverrideTable_Encode(&rItemOverrides, &letter, 1));
+    fakeGlobalContext.sceneNum = 0x4A;
+
+    // With the queue full the letter isn't marked as given
+    for (u32 i = 0; i < PENDING_OVERRIDES_MAX; ++i) {
+        ItemOverride_PushPendingOverride(MakeOverride(3, i, 0x42));
+    }
+    ItemOverride_CheckZeldasLetter();
+    CHECK(fakeEvents[0x40] == 0);
+
+    // so it is queued once there's room
+    ItemOverride_PopPendingOverride();
+    ItemOverride_CheckZeldasLetter();
+    CHECK(fakeEvents[0x40] == 1);
+    CHECK(Queued() == PENDING_OVERRIDES_MAX);
+    for (u32 i = 1; i < PENDING_OVERRIDES_MAX; ++i) {
+        ItemOverride_PopPendingOverride();
+    }
+    CHECK(ItemOverride_PeekPendingOverride().key.all == letter.key.all);
+    EmptyQueue();
+}
+
+static ItemOverride MakeDelayedOverride(u8 type, u8 flag, u8 itemId) {
+    ItemOverride override = MakeOverride(0xFF, flag, itemId);
+    override.key.type = type;
+    return override;
+}
+
+// Delayed items and dungeon rewards have their cutscene flag set already, so
+// with the queue full they wait and are queued in order once there's room
+static void CheckRetry(void) {
+    ItemOverride table[RETRY_OVERRIDES_MAX + 2];
+    u32 count = 0;
+    PendingOverrideStats stats;
+
+    table[count++] = MakeDelayedOverride(OVR_TEMPLE, DUNGEON_DEKU_TREE, 0x6C);
+    for (u32 i = 0; i <= RETRY_OVERRIDES_MAX; ++i) {
+        table[count++] = MakeDelayedOverride(OVR_DELAYED, 0x20 + i, 0x42);
+    }
+    // sorted by key.all, as the app writes them
+    for (u32 i = 1; i < count; ++i) {
+        for (u32 j = i; j > 0 && table[j - 1].key.all > table[j].key.all; --j) {
+            ItemOverride swap = table[j];
+            table[j] = table[j - 1];
+            table[j - 1] = swap;
+        }
+    }
+    CHECK(OverrideTable_Encode(&rItemOverrides, table, count));
+
+    for (u32 i = 0; i < PENDING_OVERRIDES_MAX; ++i) {
+        ItemOverride_PushPendingOverride(MakeOverride(4, i, 0x42));
+    }
+    ItemOverride_PushDelayedOverride(0x20);
+    ItemOverride_PushDungeonReward(DUNGEON_DEKU_TREE);
+    ItemOverride_PushDelayedOverride(0x20); // already waiting
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.queued == PENDING_OVERRIDES_MAX);
+    CHECK(stats.waiting == 2);
+
+    // Room for one, the first to wait goes first
+    ItemOverride_PopPendingOverride();
+    ItemOverride_RetryOverrides();
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.queued == PENDING_OVERRIDES_MAX);
+    CHECK(stats.waiting == 1);
+
+    // A new item waits behind the dungeon reward even once there's room
+    ItemOverride_PopPendingOverride();
+    ItemOverride_PushDelayedOverride(0x21);
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.waiting == 1);
+    ItemOverride_PopPendingOverride();
+    ItemOverride_RetryOverrides();
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.waiting == 0);
+
+    for (u32 i = 3; i < PENDING_OVERRIDES_MAX; ++i) {
+        CHECK(ItemOverride_PeekPendingOverride().key.scene == 4);
+        ItemOverride_PopPendingOverride();
+    }
+    CHECK(ItemOverride_PeekPendingOverride().key.flag == 0x20);
+    ItemOverride_PopPendingOverride();
+    CHECK(ItemOverride_PeekPendingOverride().key.type == OVR_TEMPLE);
+    ItemOverride_PopPendingOverride();
+    CHECK(ItemOverride_PeekPendingOverride().key.flag == 0x21);
+    ItemOverride_PopPendingOverride();
+    CHECK(ItemOverride_PeekPendingOverride().key.all == 0);
+
+    // Only once the waiting list is full too is an item dropped
+    for (u32 i = 0; i < PENDING_OVERRIDES_MAX; ++i) {
+        ItemOverride_PushPendingOverride(MakeOverride(4, i, 0x42));
+    }
+    for (u32 i = 0; i <= RETRY_OVERRIDES_MAX; ++i) {
+        ItemOverride_PushDelayedOverride(0x20 + i);
+    }
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.waiting == RETRY_OVERRIDES_MAX);
+    CHECK(stats.overflows == 1);
+
+    EmptyQueue();
+    ItemOverride_RetryOverrides();
+    EmptyQueue();
+    ItemOverride_GetPendingStats(&stats);
+    CHECK(stats.waiting == 0);
+}
+
+int main(void) {
+    CheckAgainstModel();
+    CheckFullQueue();
+    CheckZeldasLetter();
+    CheckRetry();
+
+    return TEST_RESULT();
+}
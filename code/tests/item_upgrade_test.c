@@ -0,0 +1,131 @@
+// Checks that item_table.c's upgrade cache follows every save field the resolvers read
+#include "test.h"
+#include "z3D/z3D.h"
+#include <string.h>
+
+// The save kept in memory instead of at its game address
+#undef gSaveContext
+#define gSaveContext fakeSaveContext
+
+static SaveContext fakeSaveContext;
+
+#include "z3D.c"
+#include "item_upgrade.c"
+#include "item_effect.c"
+#include "item_table.c"
+
+// What item_effect.c needs from the rest of the patch
+SettingsContext gSettingsContext;
+void IceTrap_Push(void) {}
+
+#define GI_PROGRESSIVE_HOOKSHOT 0x80
+#define GI_PROGRESSIVE_BOW 0x83
+#define GI_PROGRESSIVE_BOMBCHUS 0x89
+#define GI_PROGRESSIVE_MAGIC 0x8A
+#define GI_PROGRESSIVE_OCARINA 0x8B
+#define GI_BOTTLED_RUTOS_LETTER 0x15
+#define GI_REDUNDANT_LETTER_BOTTLE 0xC8
+
+// A save without any of the upgrades, so every progressive item has somewhere to go
+static void ResetSave(void) {
+    memset(&fakeSaveContext, 0, sizeof(fakeSaveContext));
+    memset(fakeSaveContext.items, ITEM_NONE, sizeof(fakeSaveContext.items));
+}
+
+// Resolves every row, which leaves each of them cached
+static void ResolveAll(void) {
+    for (u16 itemId = 0; itemId < ARR_SIZE(rItemTable); ++itemId) {
+        if (ItemTable_GetItemRow(itemId) != NULL) {
+            u16 resolvedItemId = ItemTable_ResolveUpgrades(itemId);
+            CHECK(resolvedItemId == ItemTable_ResolveUpgradesUncached(itemId));
+            CHECK(rResolvedUpgrades[itemId] == resolvedItemId);
+        }
+    }
+}
+
+// After the save changes, the next lookup drops every cached row
+// and the rows resolve again for the new save
+static void CheckInvalidated(u16 itemId, u16 expectedItemId) {
+    CHECK(ItemTable_ResolveUpgrades(itemId) == expectedItemId);
+    for (u16 i = 0; i < ARR_SIZE(rResolvedUpgrades); ++i) {
+        if (i != itemId) {
+            CHECK(rResolvedUpgrades[i] == 0);
+        }
+    }
+    ResolveAll();
+}
+
+static void CheckBaseline(void) {
+    ResetSave();
+    ResolveAll();
+    CHECK(ItemTable_ResolveUpgrades(GI_PROGRESSIVE_HOOKSHOT) == GI_HOOKSHOT);
+    CHECK(ItemTable_ResolveUpgrades(GI_PROGRESSIVE_BOW) == GI_BOW);
+    CHECK(ItemTable_ResolveUpgrades(GI_PROGRESSIVE_BOMBCHUS) == GI_BOMBCHUS_10);
+    CHECK(ItemTable_ResolveUpgrades(GI_PROGRESSIVE_MAGIC) == 0xB9);
+    CHECK(ItemTable_ResolveUpgrades(GI_PROGRESSIVE_OCARINA) == GI_OCARINA_FAIRY);
+    CHECK(ItemTable_ResolveUpgrades(GI_BOTTLED_RUTOS_LETTER) == GI_BOTTLED_RUTOS_LETTER);
+
+    // Fields no resolver reads leave the cache alone
+    fakeSaveContext.rupees = 500;
+    fakeSaveContext.items[SLOT_BOW] = ITEM_BOW;
+    fakeSaveContext.ammo[SLOT_BOW] = 30;
+    fakeSaveContext.eventChkInf[4] = 0xFFFF;
+    ItemTable_ResolveUpgrades(GI_PROGRESSIVE_BOW);
+    for (u16 itemId = 0; itemId < ARR_SIZE(rItemTable); ++itemId) {
+        if (ItemTable_GetItemRow(itemId) != NULL) {
+            CHECK(rResolvedUpgrades[itemId] != 0);
+        }
+    }
+}
+
+static void CheckEachInput(void) {
+    ResetSave();
+    ResolveAll();
+    fakeSaveContext.upgrades |= 1; // Bow
+    CheckInvalidated(GI_PROGRESSIVE_BOW, GI_QUIVER_40);
+
+    ResetSave();
+    ResolveAll();
+    fakeSaveContext.eventChkInf[3] |= 0x0008; // King Zora Moved Aside
+    CheckInvalidated(GI_BOTTLED_RUTOS_LETTER, GI_REDUNDANT_LETTER_BOTTLE);
+
+    ResetSave();
+    ResolveAll();
+    fakeSaveContext.magicAcquired = 1;
+    CheckInvalidated(GI_PROGRESSIVE_MAGIC, 0xBA);
+
+    ResetSave();
+    ResolveAll();
+    fakeSaveContext.items[SLOT_HOOKSHOT] = ITEM_HOOKSHOT;
+    CheckInvalidated(GI_PROGRESSIVE_HOOKSHOT, GI_LONGSHOT);
+
+    ResetSave();
+    ResolveAll();
+    fakeSaveContext.items[SLOT_OCARINA] = ITEM_OCARINA_FAIRY;
+    CheckInvalidated(GI_PROGRESSIVE_OCARINA, GI_OCARINA_OOT);
+
+    ResetSave();
+    ResolveAll();
+    // No row resolves differently for this one, but the cache still has to drop
+    fakeSaveContext.items[SLOT_BOMBCHU] = ITEM_BOMBCHU;
+    CheckInvalidated(GI_PROGRESSIVE_BOMBCHUS, ItemTable_ResolveUpgradesUncached(GI_PROGRESSIVE_BOMBCHUS));
+
+    ResetSave();
+    ResolveAll();
+    fakeSaveContext.ammo[SLOT_BOMBCHU] = 6;
+    CheckInvalidated(GI_PROGRESSIVE_BOMBCHUS, GI_BOMBCHUS_5);
+
+    for (u32 i = 0; i < 4; ++i) {
+        ResetSave();
+        ResolveAll();
+        fakeSaveContext.items[SLOT_BOTTLE_1 + i] = ITEM_LETTER_RUTO;
+        CheckInvalidated(GI_BOTTLED_RUTOS_LETTER, GI_REDUNDANT_LETTER_BOTTLE);
+    }
+}
+
+int main(void) {
+    CheckBaseline();
+    CheckEachInput();
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,111 @@
+// Checks the extended object slot map in objects.c against a fake object context
+#include "test.h"
+#include "objects.h"
+#include <string.h>
+
+// The game's object functions, working on plain memory
+#undef Object_Spawn
+#undef Object_GetIndex
+#undef Object_IsLoaded
+#undef Object_Clear
+#define Object_Spawn Fake_Object_Spawn
+#define Object_GetIndex Fake_Object_GetIndex
+#define Object_IsLoaded Fake_Object_IsLoaded
+#define Object_Clear Fake_Object_Clear
+
+static s32 Fake_Object_Spawn(ObjectContext* objectCtx, s16 objectId) {
+    objectCtx->status[objectCtx->num].id = -objectId; // negative until loaded
+    return objectCtx->num++;
+}
+
+static s32 Fake_Object_GetIndex(ObjectContext* objectCtx, s16 objectId) {
+    for (s32 i = 0; i < objectCtx->num; ++i) {
+        if (objectCtx->status[i].id == objectId || objectCtx->status[i].id == -objectId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static s32 Fake_Object_IsLoaded(ObjectContext* objectCtx, s16 bankIndex) {
+    return objectCtx->status[bankIndex].id >= 0;
+}
+
+static void Fake_Object_Clear(GlobalContext* globalCtx, ObjectContext* objectCtx) {
+    memset(objectCtx, 0, sizeof(*objectCtx));
+}
+
+#include "objects.c"
+
+GlobalContext* gGlobalContext;
+
+static ObjectContext gameObjectCtx;
+
+// Finds the next objectId after objectId that lands in the same bucket
+static s16 CollidingObjectId(s16 objectId) {
+    s16 other = objectId + 1;
+    while (ObjectSlotMap_Hash(other) != ObjectSlotMap_Hash(objectId)) {
+        other++;
+    }
+    return other;
+}
+
+static void CheckSpawned(s16 objectId, s32 slot) {
+    CHECK(ExtendedObject_GetIndex(&gameObjectCtx, objectId) == slot + OBJECT_EXCHANGE_BANK_MAX);
+    CHECK(ExtendedObject_GetStatus(objectId) == &rExtendedObjectCtx.status[slot]);
+}
+
+static void CheckNotSpawned(s16 objectId) {
+    CHECK(ExtendedObject_GetIndex(&gameObjectCtx, objectId) == -1);
+    CHECK(ExtendedObject_GetStatus(objectId) == NULL);
+}
+
+int main(void) {
+    const s16 iceTrap = 0x3;
+    const s16 sameBucket = CollidingObjectId(iceTrap);
+    const s16 sameBucketMissing = CollidingObjectId(sameBucket);
+    s16 objectIds[OBJECT_EXCHANGE_BANK_MAX];
+
+    // Nothing is spawned before the first clear
+    CheckNotSpawned(iceTrap);
+
+    ExtendedObject_Clear(NULL, &gameObjectCtx);
+    CheckNotSpawned(iceTrap);
+
+    CHECK(ExtendedObject_Spawn(&gameObjectCtx, iceTrap) == OBJECT_EXCHANGE_BANK_MAX);
+    CHECK(ExtendedObject_Spawn(&gameObjectCtx, sameBucket) == OBJECT_EXCHANGE_BANK_MAX + 1);
+    CheckSpawned(iceTrap, 0);
+    CheckSpawned(sameBucket, 1);
+
+    // A probe chain that reaches an empty entry is a miss, even for an id in a used bucket
+    CheckNotSpawned(sameBucketMissing);
+    CheckNotSpawned(0x100);
+
+    // and a miss comes from the map alone, without scanning the banks
+    rExtendedObjectCtx.status[rExtendedObjectCtx.num++].id = sameBucketMissing;
+    CheckNotSpawned(sameBucketMissing);
+    rExtendedObjectCtx.status[--rExtendedObjectCtx.num].id = 0;
+
+    // Loading flips the sign of the bank's id, which doesn't change the slot
+    rExtendedObjectCtx.status[0].id = iceTrap;
+    CheckSpawned(iceTrap, 0);
+
+    // Objects in the game's own banks are found there first
+    Fake_Object_Spawn(&gameObjectCtx, 0x100);
+    CHECK(ExtendedObject_GetIndex(&gameObjectCtx, 0x100) == 0);
+
+    // Clearing forgets every extended object, and fills all the banks again from slot 0
+    ExtendedObject_Clear(NULL, &gameObjectCtx);
+    CheckNotSpawned(iceTrap);
+    CheckNotSpawned(sameBucket);
+    for (s32 i = 0; i < OBJECT_EXCHANGE_BANK_MAX; ++i) {
+        objectIds[i] = (i == 0) ? iceTrap : CollidingObjectId(objectIds[i - 1]);
+        CHECK(ExtendedObject_Spawn(&gameObjectCtx, objectIds[i]) == i + OBJECT_EXCHANGE_BANK_MAX);
+    }
+    for (s32 i = 0; i < OBJECT_EXCHANGE_BANK_MAX; ++i) {
+        CheckSpawned(objectIds[i], i);
+    }
+    CheckNotSpawned(CollidingObjectId(objectIds[OBJECT_EXCHANGE_BANK_MAX - 1]));
+
+    return TEST_RESULT();
+}
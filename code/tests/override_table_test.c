@@ -0,0 +1,125 @@
+// Checks that override tables find exactly the overrides they were encoded from
+#include "test.h"
+#include "override_table.h"
+#include <stdlib.h>
+
+#define OVERRIDES_COUNT 300
+
+static OverrideTable table;
+static ItemOverride overrides[OVERRIDES_COUNT];
+
+static ItemOverride MakeOverride(u8 scene, u8 type, u8 flag, u8 itemId, u8 looksLikeItemId) {
+    ItemOverride override;
+    override.key.all = 0;
+    override.key.scene = scene;
+    override.key.type = type;
+    override.key.flag = flag;
+    override.value.all = 0;
+    override.value.itemId = itemId;
+    override.value.looksLikeItemId = looksLikeItemId;
+    return override;
+}
+
+static ItemOverride_Key MakeKey(u8 scene, u8 type, u8 flag) {
+    return MakeOverride(scene, type, flag, 0, 0).key;
+}
+
+// The app sorts overrides by key.all before encoding them
+static int CompareKeys(const void* a, const void* b) {
+    u32 keyA = ((const ItemOverride*)a)->key.all;
+    u32 keyB = ((const ItemOverride*)b)->key.all;
+    return (keyA > keyB) - (keyA < keyB);
+}
+
+static void CheckMiss(ItemOverride_Key key) {
+    ItemOverride found = OverrideTable_Find(&table, key);
+    CHECK(found.key.all == 0);
+    CHECK(found.value.all == 0);
+}
+
+static void CheckRoundTrips(void) {
+    u32 count = 0;
+
+    // The first and last buckets, each with several entries
+    overrides[count++] = MakeOverride(0, OVR_CHEST, 0x01, 0x10, 0);
+    overrides[count++] = MakeOverride(0, OVR_COLLECTABLE, 0x01, 0x11, 0x20);
+    overrides[count++] = MakeOverride(0, OVR_CHEST, 0x1F, 0x12, 0);
+    overrides[count++] = MakeOverride(0xFF, OVR_DELAYED, 0x00, 0x13, 0);
+    overrides[count++] = MakeOverride(0xFF, OVR_TEMPLE, 0xFF, 0x14, 0xFF);
+    overrides[count++] = MakeOverride(0xFF, OVR_DELAYED, 0x20, 0xFF, 0x01);
+    // Everything else spread over the scenes in between, leaving some empty
+    srand(1);
+    while (count < OVERRIDES_COUNT) {
+        u8 scene = 1 + (rand() % 100) * 2;
+        ItemOverride override = MakeOverride(scene, rand() % 7, rand() % 256, rand() % 256, rand() % 256);
+        s32 duplicate = 0;
+        for (u32 i = 0; i < count; ++i) {
+            duplicate |= (overrides[i].key.all == override.key.all);
+        }
+        if (!duplicate) {
+            overrides[count++] = override;
+        }
+    }
+    qsort(overrides, count, sizeof(overrides[0]), CompareKeys);
+
+    CHECK(OverrideTable_Encode(&table, overrides, count));
+    CHECK(OverrideTable_Count(&table) == count);
+    for (u32 scene = 0; scene < OVERRIDE_SCENES_MAX; ++scene) {
+        CHECK(table.sceneStart[scene] <= table.sceneStart[scene + 1]);
+    }
+    CHECK(table.sceneStart[1] == 3);
+    CHECK(table.sceneStart[OVERRIDE_SCENES_MAX] - table.sceneStart[OVERRIDE_SCENES_MAX - 1] == 3);
+
+    for (u32 i = 0; i < count; ++i) {
+        ItemOverride found = OverrideTable_Find(&table, overrides[i].key);
+        CHECK(found.key.all == overrides[i].key.all);
+        CHECK(found.value.all == overrides[i].value.all);
+    }
+
+    // Same scene, type or flag as an entry, but not the same key
+    CheckMiss(MakeKey(0, OVR_CHEST, 0x02));
+    CheckMiss(MakeKey(0, OVR_SKULL, 0x01));
+    CheckMiss(MakeKey(0, OVR_CHEST, 0x00));
+    CheckMiss(MakeKey(0xFF, OVR_DELAYED, 0x01));
+    CheckMiss(MakeKey(0xFF, OVR_CHEST, 0xFF));
+    CheckMiss(MakeKey(0xFE, OVR_DELAYED, 0x00));
+    for (u32 i = 0; i < 1000; ++i) {
+        ItemOverride search = MakeOverride(1 + (rand() % 100) * 2, rand() % 7, rand() % 256, 0, 0);
+        if (bsearch(&search, overrides, count, sizeof(overrides[0]), CompareKeys) == NULL) {
+            CheckMiss(search.key);
+        }
+    }
+    // Scenes without any overrides
+    for (u32 scene = 2; scene < 0xFF; scene += 2) {
+        CheckMiss(MakeKey(scene, OVR_CHEST, 0x01));
+    }
+}
+
+static void CheckEncodeLimits(void) {
+    ItemOverride tooBig[2] = {
+        MakeOverride(5, OVR_CHEST, 0x01, 0x10, 0),
+        MakeOverride(5, OVR_CHEST, 0x02, 0x10, 0),
+    };
+
+    // Item ids and players that don't fit in a packed entry
+    tooBig[1].value.itemId = 0x100;
+    CHECK(!OverrideTable_Encode(&table, tooBig, 2));
+    tooBig[1].value.itemId = 0x10;
+    tooBig[1].value.player = 1;
+    CHECK(!OverrideTable_Encode(&table, tooBig, 2));
+
+    CHECK(!OverrideTable_Encode(&table, overrides, OVERRIDE_ENTRIES_MAX + 1));
+
+    // An empty table finds nothing
+    CHECK(OverrideTable_Encode(&table, overrides, 0));
+    CHECK(OverrideTable_Count(&table) == 0);
+    CheckMiss(MakeKey(0, OVR_CHEST, 0x01));
+    CheckMiss(MakeKey(0xFF, OVR_DELAYED, 0x00));
+}
+
+int main(void) {
+    CheckRoundTrips();
+    CheckEncodeLimits();
+
+    return TEST_RESULT();
+}
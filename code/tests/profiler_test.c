@@ -0,0 +1,66 @@
+// Checks the profiler's sample windows with a fake tick source
+#define ENABLE_PROFILER
+#include "test.h"
+#include "profiler.c"
+
+static u64 fakeTick = 0;
+
+u64 svcGetSystemTick(void) {
+    return fakeTick;
+}
+
+// Times one section that takes the given number of ticks
+static void RunSection(ProfileSection section, u32 ticks) {
+    PROFILE_BEGIN(tick);
+    fakeTick += ticks;
+    PROFILE_END(section, tick);
+}
+
+static ProfileSummary Summary(ProfileSection section) {
+    ProfileSummary summary;
+    Profile_GetSummary(section, &summary);
+    return summary;
+}
+
+int main(void) {
+    ProfileSummary summary;
+
+    // Nothing recorded yet
+    summary = Summary(PROFILE_MODEL_DRAW);
+    CHECK(summary.count == 0 && summary.min == 0 && summary.avg == 0 && summary.max == 0);
+
+    fakeTick = 0xFFFFFF00; // the deltas don't care where the tick count is
+    RunSection(PROFILE_MODEL_DRAW, 300);
+    RunSection(PROFILE_MODEL_DRAW, 100);
+    RunSection(PROFILE_MODEL_DRAW, 200);
+    summary = Summary(PROFILE_MODEL_DRAW);
+    CHECK(summary.count == 3);
+    CHECK(summary.min == 100);
+    CHECK(summary.avg == 200);
+    CHECK(summary.max == 300);
+
+    // Sections are kept apart
+    RunSection(PROFILE_INPUT_UPDATE, 7);
+    CHECK(Summary(PROFILE_INPUT_UPDATE).count == 1);
+    CHECK(Summary(PROFILE_INPUT_UPDATE).max == 7);
+    CHECK(Summary(PROFILE_MODEL_DRAW).count == 3);
+
+    // Once the window is full, the oldest samples drop out
+    for (u32 i = 0; i < PROFILE_WINDOW; ++i) {
+        RunSection(PROFILE_MODEL_DRAW, 1000 + i);
+    }
+    summary = Summary(PROFILE_MODEL_DRAW);
+    CHECK(summary.count == PROFILE_WINDOW);
+    CHECK(summary.min == 1000);
+    CHECK(summary.max == 1000 + PROFILE_WINDOW - 1);
+    CHECK(summary.avg == 1000 + (PROFILE_WINDOW - 1) / 2);
+
+    // Samples recorded without the tick source go in the same window
+    Profile_Record(PROFILE_MODEL_DRAW, 5);
+    summary = Summary(PROFILE_MODEL_DRAW);
+    CHECK(summary.count == PROFILE_WINDOW);
+    CHECK(summary.min == 5);
+    CHECK(summary.max == 1000 + PROFILE_WINDOW - 1);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,131 @@
+// Checks rHeap's bump region and size classes
+#include "test.h"
+#include "rHeap.c"
+#include "models.h"
+
+static rHeapStats Stats(void) {
+    rHeapStats stats;
+    rHeap_GetStats(&stats);
+    return stats;
+}
+
+static void CheckBump(void) {
+    rHeap_Init();
+    CHECK(Stats().bumpSize == RHEAP_ROUND(sizeof(Actor)));
+
+    void* actor = rHeap_Alloc(sizeof(Actor));
+    CHECK(actor == &rHeap[0]);
+    CHECK(Stats().bumpUsed == RHEAP_ROUND(sizeof(Actor)));
+
+    // The bump region is full, the size classes after it stay untouched
+    CHECK(rHeap_Alloc(1) == NULL);
+    CHECK(Stats().overflows == 1);
+    CHECK(Stats().bumpUsed == RHEAP_ROUND(sizeof(Actor)));
+}
+
+// Every size goes to the smallest class it fits in
+static void CheckClassSizes(void) {
+    static const u16 blockSizes[RHEAP_SMALL_CLASSES] = { 16, 32, 64, 128 };
+
+    rHeap_Init();
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        CHECK(Stats().classBlockSize[c] == blockSizes[c]);
+        CHECK(Stats().classCapacity[c] == rHeapClassCapacity[c]);
+
+        u32 smallest = (c == 0) ? 1 : blockSizes[c - 1] + 1;
+        CHECK(rHeap_SmallCapacity(smallest) == rHeapClassCapacity[c]);
+        CHECK(rHeap_SmallCapacity(blockSizes[c]) == rHeapClassCapacity[c]);
+
+        char* small = rHeap_AllocSmall(smallest);
+        char* big = rHeap_AllocSmall(blockSizes[c]);
+        CHECK(small != NULL && big != NULL && small != big);
+        CHECK(small >= rHeapClasses[c].start && small < rHeapClasses[c].start + blockSizes[c] * rHeapClassCapacity[c]);
+        CHECK((big - small) % blockSizes[c] == 0);
+        CHECK(Stats().classUsed[c] == 2);
+    }
+
+    // Nothing bigger than the biggest class has a place
+    CHECK(rHeap_SmallCapacity(129) == 0);
+    CHECK(rHeap_AllocSmall(129) == NULL);
+    CHECK(Stats().overflows == 1);
+}
+
+static void CheckClassUse(u32 c) {
+    const u16 blockSize = rHeapClassBlockSize[c];
+    const u16 capacity = rHeapClassCapacity[c];
+    void* blocks[128];
+
+    rHeap_Init();
+
+    // A freed block is the next one handed out
+    void* first = rHeap_AllocSmall(blockSize);
+    rHeap_Free(first);
+    CHECK(Stats().classUsed[c] == 0);
+    CHECK(rHeap_AllocSmall(blockSize) == first);
+    rHeap_Free(first);
+
+    // Every block can be used once, then the class is full and doesn't spill
+    // into a bigger one
+    for (u32 i = 0; i < capacity; ++i) {
+        blocks[i] = rHeap_AllocSmall(blockSize);
+        CHECK(blocks[i] != NULL);
+        for (u32 j = 0; j < i; ++j) {
+            CHECK(blocks[i] != blocks[j]);
+        }
+    }
+    CHECK(rHeap_AllocSmall(blockSize) == NULL);
+    CHECK(Stats().overflows == 1);
+    CHECK(Stats().classUsed[c] == capacity);
+    CHECK(Stats().classPeak[c] == capacity);
+    for (u32 other = 0; other < RHEAP_SMALL_CLASSES; ++other) {
+        CHECK(other == c || Stats().classUsed[other] == 0);
+    }
+
+    for (u32 i = 0; i < capacity; ++i) {
+        rHeap_Free(blocks[i]);
+    }
+    CHECK(Stats().classUsed[c] == 0);
+    CHECK(Stats().badFrees == 0);
+}
+
+static void CheckBadFrees(void) {
+    u32 notFromTheHeap;
+
+    rHeap_Init();
+    void* actor = rHeap_Alloc(sizeof(Actor));
+    char* block = rHeap_AllocSmall(32);
+
+    rHeap_Free(NULL);
+    CHECK(Stats().badFrees == 0);
+
+    rHeap_Free(&notFromTheHeap);
+    rHeap_Free(actor);
+    rHeap_Free(block + 1);
+    CHECK(Stats().badFrees == 3);
+    CHECK(Stats().classUsed[1] == 1);
+
+    // None of them reached a free list, so what's left are the class's own blocks
+    for (u32 i = 1; i < rHeapClassCapacity[1]; ++i) {
+        char* next = rHeap_AllocSmall(32);
+        CHECK(next >= rHeapClasses[1].start && next < rHeapClasses[1].start + 32 * rHeapClassCapacity[1]);
+        CHECK((next - block) % 32 == 0);
+    }
+    CHECK(rHeap_AllocSmall(32) == NULL);
+}
+
+// A Model is 28 bytes on the 3DS, its class must have a block for every model
+static void CheckModelClass(void) {
+    CHECK(rHeap_SmallCapacity(28) >= MODELS_CAPACITY);
+}
+
+int main(void) {
+    CheckBump();
+    CheckClassSizes();
+    for (u32 c = 0; c < RHEAP_SMALL_CLASSES; ++c) {
+        CheckClassUse(c);
+    }
+    CheckBadFrees();
+    CheckModelClass();
+
+    return TEST_RESULT();
+}
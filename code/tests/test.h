@@ -0,0 +1,23 @@
+#pragma once
+
+// Include this before the source under test, lib/printf.h renames printf to
+// the patch's own and the tests print with the host's
+
+#include <stdio.h>
+
+static int testFailures = 0;
+
+static void Test_Fail(const char* file, int line, const char* condition) {
+    printf("%s:%d: CHECK(%s) failed\n", file, line, condition);
+    testFailures++;
+}
+
+// Reports a failed condition and keeps going, so one run lists every failure
+#define CHECK(condition)                                  \
+    do {                                                  \
+        if (!(condition)) {                               \
+            Test_Fail(__FILE__, __LINE__, #condition);    \
+        }                                                 \
+    } while (0)
+
+#define TEST_RESULT() (testFailures == 0 ? 0 : 1)
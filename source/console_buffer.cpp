@@ -0,0 +1,69 @@
+#include "console_buffer.hpp"
+
+#include <cstdio>
+
+void ConsoleBuffer::Clear() {
+  back.fill({' ', CellColor::Normal});
+}
+
+void ConsoleBuffer::ClearRows(int firstRow, int rowCount) {
+  for (int row = firstRow; row < firstRow + rowCount && row < ROWS; row++) {
+    for (int col = 0; col < cols; col++) {
+      back[row * cols + col] = {' ', CellColor::Normal};
+    }
+  }
+}
+
+void ConsoleBuffer::Print(int row, int col, std::string_view text, CellColor color /*= CellColor::Normal*/) {
+  for (char c : text) {
+    if (c == '\n') {
+      row++;
+      col = 0;
+      continue;
+    }
+    //like the console, only move to the next row once there's more to print
+    if (col >= cols) {
+      row++;
+      col = 0;
+    }
+    if (row >= ROWS) {
+      return;
+    }
+    back[row * cols + col] = {c, color};
+    col++;
+  }
+}
+
+void ConsoleBuffer::Flush() {
+  static constexpr std::array<const char*, 4> colorCodes = {RESET, GREEN, DIM, CYAN};
+
+  for (int row = 0; row < ROWS; row++) {
+    int col = 0;
+    while (col < cols) {
+      const int start = row * cols;
+      if (front[start + col] == back[start + col]) {
+        col++;
+        continue;
+      }
+
+      //gather a run of changed cells with the same color and print them together
+      const int runStart = col;
+      const CellColor color = back[start + col].color;
+      char run[MAX_COLS + 1];
+      int runLength = 0;
+      while (col < cols && front[start + col] != back[start + col] && back[start + col].color == color) {
+        run[runLength++] = back[start + col].c;
+        front[start + col] = back[start + col];
+        col++;
+      }
+      run[runLength] = '\0';
+
+      printf("\x1b[%d;%dH%s%s%s", row, runStart, colorCodes[static_cast<size_t>(color)], run, RESET);
+    }
+  }
+}
+
+void ConsoleBuffer::Invalidate() {
+  //no cell can match this, so everything gets printed
+  front.fill({'\0', CellColor::Normal});
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <3ds.h>
+
+#include <array>
+#include <string_view>
+
+#include "menu.hpp"
+
+enum class CellColor : u8 {
+  Normal,
+  Green,
+  Dim,
+  Cyan,
+};
+
+//Text-cell copy of a screen's console, cols wide. A frame is drawn into the back
+//buffer, then Flush compares it with what's already on screen and only prints
+//the cells that changed, instead of clearing and redrawing every line.
+class ConsoleBuffer {
+public:
+  explicit ConsoleBuffer(int cols_) : cols(cols_) {
+    Clear();
+    Invalidate();
+  }
+
+  //Start a new frame
+  void Clear();
+  //Blank rowCount rows starting at firstRow, leaving the rest of the frame as it is
+  void ClearRows(int firstRow, int rowCount);
+  //Write text into the frame, a '\n' or the right edge continues at the start of the next row
+  void Print(int row, int col, std::string_view text, CellColor color = CellColor::Normal);
+  //Print the cells that differ from the last flushed frame. The console to draw on must be selected.
+  void Flush();
+  //The console was drawn to directly, so redraw every cell on the next Flush
+  void Invalidate();
+
+private:
+  struct Cell {
+    char c;
+    CellColor color;
+
+    bool operator==(const Cell& other) const {
+      return c == other.c && color == other.color;
+    }
+
+    bool operator!=(const Cell& other) const {
+      return !operator==(other);
+    }
+  };
+
+  static constexpr int ROWS = SCREEN_HEIGHT;
+  static constexpr int MAX_COLS = TOP_WIDTH;
+
+  int cols;
+  std::array<Cell, ROWS * MAX_COLS> front;
+  std::array<Cell, ROWS * MAX_COLS> back;
+};
@@ -1,10 +1,11 @@
 #include "custom_messages.hpp"
 #include "patch_symbols.hpp"
+#include "seed_arena.hpp"
 #include "../code/src/message.h"
 
 #include <array>
+#include <memory_resource>
 #include <set>
-#include <sstream>
 #include <vector>
 
 namespace CustomMessages {
@@ -129,10 +130,9 @@ constexpr std::array DungeonColors = {
     CustomMessages::QM_RED,
 };
 
-    std::set<MessageEntry, MessageEntryComp> messageEntries;
+    std::pmr::set<MessageEntry, MessageEntryComp> messageEntries{SeedArena_Resource()};
     std::vector<MessageEntry> arrangedMessageEntries;
-    std::stringstream messageData;
-    std::string arrangedMessageData;
+    std::pmr::string messageData{SeedArena_Resource()};
 
     //textBoxType and textBoxPosition are defined here: https://wiki.cloudmodding.com/oot/Text_Format#Message_Id
     void CreateMessage(u32 textId, u32 unk_04, u32 textBoxType, u32 textBoxPosition,
@@ -140,22 +140,19 @@ constexpr std::array DungeonColors = {
             MessageEntry newEntry = { textId, unk_04, textBoxType, textBoxPosition, { 0 } };
 
             while ((englishText.size() % 4) != 0) englishText += "\0"s;
-            messageData.seekg(0, messageData.end);
-            newEntry.info[ENGLISH_U].offset = (char*)((int)messageData.tellg()) + RCUSTOMMESSAGES_ADDR;
+            newEntry.info[ENGLISH_U].offset = (char*)((int)messageData.size()) + RCUSTOMMESSAGES_ADDR;
             newEntry.info[ENGLISH_U].length = englishText.size();
-            messageData << englishText;
+            messageData += englishText;
 
             while ((frenchText.size() % 4) != 0) frenchText += "\0"s;
-            messageData.seekg(0, messageData.end);
-            newEntry.info[FRENCH_U].offset = (char*)((int)messageData.tellg()) + RCUSTOMMESSAGES_ADDR;
+            newEntry.info[FRENCH_U].offset = (char*)((int)messageData.size()) + RCUSTOMMESSAGES_ADDR;
             newEntry.info[FRENCH_U].length = frenchText.size();
-            messageData << frenchText;
+            messageData += frenchText;
 
             while ((spanishText.size() % 4) != 0) spanishText += "\0"s;
-            messageData.seekg(0, messageData.end);
-            newEntry.info[SPANISH_U].offset = (char*)((int)messageData.tellg()) + RCUSTOMMESSAGES_ADDR;
+            newEntry.info[SPANISH_U].offset = (char*)((int)messageData.size()) + RCUSTOMMESSAGES_ADDR;
             newEntry.info[SPANISH_U].length = spanishText.size();
-            messageData << spanishText;
+            messageData += spanishText;
 
             messageEntries.insert(newEntry);
     }
@@ -164,6 +161,12 @@ constexpr std::array DungeonColors = {
         return messageEntries.size();
     }
 
+    //Messages are rebuilt for every seed, this also gives their memory back to the seed arena
+    void ClearMessages() {
+        messageEntries.clear();
+        std::pmr::string{SeedArena_Resource()}.swap(messageData);
+    }
+
     std::pair<const char*, u32> RawMessageEntryData() {
         arrangedMessageEntries.assign(messageEntries.begin(), messageEntries.end());
         const char* data = (const char*)arrangedMessageEntries.data();
@@ -172,9 +175,8 @@ constexpr std::array DungeonColors = {
     }
 
     std::pair<const char*, u32> RawMessageData() {
-        arrangedMessageData = messageData.str();
-        const char* data = arrangedMessageData.data();
-        u32 size = arrangedMessageData.size();
+        const char* data = messageData.data();
+        u32 size = messageData.size();
         return { data, size };
     }
 
@@ -9,6 +9,7 @@ namespace CustomMessages {
                        std::string englishText, std::string frenchText, std::string spanishText);
 
     u32 NumMessages();
+    void ClearMessages();
 
     std::pair<const char*, u32> RawMessageEntryData();
     std::pair<const char*, u32> RawMessageData();
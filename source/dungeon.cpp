@@ -62,7 +62,8 @@ void DungeonInfo::PlaceVanillaCompass() {
 }
 
 void DungeonInfo::PlaceVanillaBossKey() {
-  if (*bossKey == NoItem) {
+  //Ganon's Castle has no vanilla boss key location, the Ganon's Boss Key setting places its key
+  if (*bossKey == NoItem || *bossKey == GanonsCastle_BossKey) {
     return;
   }
 
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*Groups of locations that must stay included, and are hidden from the exclude
+  menu, while a condition on some settings holds. A location stays hidden as
+  long as any rule that covers it is active. A rule is only re-checked when one
+  of the settings it depends on has changed.
+
+  Only the members the rules call are needed from Setting and Location, so the
+  host tests in tests/ can check them without the menu or libctru.*/
+template <typename Setting, typename Location>
+struct ExclusionRule {
+  std::vector<Setting*> dependencies;
+  bool (*isForced)();
+  std::vector<Location*> (*getLocations)();
+
+  //filled in the first time the rule is checked
+  std::vector<Location*> locations;
+  std::vector<uint8_t> lastValues;
+  bool stale = true;
+  bool active = false;
+};
+
+template <typename Setting, typename Location>
+class ExclusionRules {
+public:
+  using Rule = ExclusionRule<Setting, Location>;
+
+  ExclusionRules(std::vector<Rule> rules_, size_t locationCount, uint8_t includeIndex_)
+    : rules(std::move(rules_)), forcedIncludeCount(locationCount, 0), includeIndex(includeIndex_) {}
+
+  //Recheck every rule the next time they're resolved, used after the exclude
+  //options were changed without going through the menu
+  void MarkStale() {
+    for (Rule& rule : rules) {
+      rule.stale = true;
+    }
+  }
+
+  void Resolve() {
+    for (Rule& rule : rules) {
+      if (rule.locations.empty()) {
+        rule.locations = rule.getLocations();
+      }
+
+      std::vector<uint8_t> values;
+      for (const Setting* dependency : rule.dependencies) {
+        values.push_back(dependency->GetSelectedOptionIndex());
+      }
+      if (!rule.stale && values == rule.lastValues) {
+        continue;
+      }
+
+      SetRuleActive(rule, rule.isForced());
+      rule.lastValues = std::move(values);
+      rule.stale = false;
+    }
+  }
+
+  //Number of active rules forcing the location to be included
+  uint8_t ForcedIncludeCount(const Location& loc) const {
+    return forcedIncludeCount[loc.GetId()];
+  }
+
+private:
+  void SetRuleActive(Rule& rule, bool active) {
+    for (Location* loc : rule.locations) {
+      auto* excludedOption = loc->GetExcludedOption();
+      uint8_t& count = forcedIncludeCount[loc->GetId()];
+      if (active) {
+        //always include again, a preset may have excluded it
+        excludedOption->SetSelectedIndex(includeIndex);
+        excludedOption->Hide();
+        if (!rule.active) {
+          count++;
+        }
+      } else if (rule.active && --count == 0) {
+        excludedOption->Unhide();
+      }
+    }
+    rule.active = active;
+  }
+
+  std::vector<Rule> rules;
+  std::vector<uint8_t> forcedIncludeCount;
+  uint8_t includeIndex;
+};
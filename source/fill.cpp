@@ -93,24 +93,44 @@ static int GetMaxGSCount() {
 
 enum SearchMode {REACHABILITY_SEARCH, GENERATE_PLAYTHROUGH, CHECK_BEATABLE};
 
-static std::vector<ItemLocation*> GetAccessibleLocations(std::vector<ItemLocation*> allowedLocations, SearchMode mode = REACHABILITY_SEARCH) {
+//Containers used by the search and fill loops. They are cleared instead of
+//recreated so their capacity carries over and steady state fills don't allocate.
+static struct {
+  std::vector<ItemLocation*> accessibleLocations;
+  std::vector<Exit*> exitPool;
+  std::vector<ItemLocation*> newItemLocations;
+  std::vector<ItemLocation*> sphere;
+  std::vector<std::string> buyIgnores;
+  std::vector<Item> itemsToPlace;
+  std::vector<Item> itemsToNotPlace;
+  std::vector<ItemLocation*> attemptedLocations;
+} fillScratch;
+
+//Returns the empty locations in allowedLocations that are reachable, in the order they were found.
+//The returned vector is reused by every call, so it is only valid until the next search.
+static std::vector<ItemLocation*>& GetAccessibleLocations(const LocationSet& allowedLocations, SearchMode mode = REACHABILITY_SEARCH) {
 
-  std::vector<ItemLocation*> accessibleLocations = {};
+  std::vector<ItemLocation*>& accessibleLocations = fillScratch.accessibleLocations;
+  accessibleLocations.clear();
 
   //Reset all access to begin a new search
   ApplyStartingInventory();
   Exits::AccessReset();
   LocationReset();
   Logic::UpdateHelpers();
-  std::vector<Exit *> exitPool = {&Exits::Root};
+  std::vector<Exit *>& exitPool = fillScratch.exitPool;
+  exitPool.clear();
+  exitPool.push_back(&Exits::Root);
 
   //Variables for playthrough
   int gsCount = 0;
   const int maxGsCount = GENERATE_PLAYTHROUGH ? GetMaxGSCount() : 0; //If generating playthrough want the max that's possibly useful, else doesn't matter
   bool bombchusFound = false;
-  std::vector<std::string> buyIgnores;
+  std::vector<std::string>& buyIgnores = fillScratch.buyIgnores;
+  buyIgnores.clear();
   //Variables for search
-  std::vector<ItemLocation *> newItemLocations;
+  std::vector<ItemLocation *>& newItemLocations = fillScratch.newItemLocations;
+  newItemLocations.clear();
   bool firstIteration = true;
   //If no new items are found and no events are updated, then the next iteration won't provide any new location
   while (newItemLocations.size() > 0 || EventsUpdated() || firstIteration) {
@@ -122,7 +142,8 @@ static std::vector<ItemLocation*> GetAccessibleLocations(std::vector<ItemLocatio
     }
     newItemLocations.clear();
 
-    std::vector<ItemLocation *> sphere;
+    std::vector<ItemLocation *>& sphere = fillScratch.sphere;
+    sphere.clear();
 
     for (size_t i = 0; i < exitPool.size(); i++) {
       Exit* area = exitPool[i];
@@ -179,7 +200,9 @@ static std::vector<ItemLocation*> GetAccessibleLocations(std::vector<ItemLocatio
             location->AddToPool();
 
             if (location->GetPlacedItem() == NoItem) {
-              accessibleLocations.push_back(location); //Empty location, consider for placement
+              if (allowedLocations[location->GetId()]) {
+                accessibleLocations.push_back(location); //Empty allowed location, consider for placement
+              }
             } else {
               newItemLocations.push_back(location); //Add item to cache to be considered in logic next iteration
             }
@@ -243,7 +266,8 @@ static std::vector<ItemLocation*> GetAccessibleLocations(std::vector<ItemLocatio
             //All we care about is if the game is beatable, used to pare down playthrough
             else if (mode == CHECK_BEATABLE && location->GetPlacedItem() == I_Triforce) {
               playthroughBeatable = true;
-              return {}; //Return early for efficiency
+              accessibleLocations.clear();
+              return accessibleLocations; //Return early for efficiency
             }
           }
         }
@@ -253,42 +277,35 @@ static std::vector<ItemLocation*> GetAccessibleLocations(std::vector<ItemLocatio
     erase_if(exitPool, [](Exit* e){ return e->AllAccountedFor();});
 
     if (mode == GENERATE_PLAYTHROUGH && sphere.size() > 0) {
-      playthroughLocations.push_back(sphere);
+      playthroughLocations.emplace_back(sphere.begin(), sphere.end());
     }
 
   }
-  erase_if(accessibleLocations, [allowedLocations](ItemLocation* loc){
-    for (ItemLocation* allowedLocation : allowedLocations) {
-      if (loc == allowedLocation) {
-        return false;
-      }
-    }
-    return true;
-  });
 
   return accessibleLocations;
 }
 
 static void GeneratePlaythrough() {
-  GetAccessibleLocations(allLocations, GENERATE_PLAYTHROUGH);
+  GetAccessibleLocations(GetLocationSet(allLocations), GENERATE_PLAYTHROUGH);
 }
 
 //Remove unnecessary items from playthrough by removing their location, and checking if game is still beatable
 //To reduce searches, some preprocessing is done in playthrough generation to avoid adding obviously unnecessary items
 static void PareDownPlaythrough() {
+  const LocationSet allLocationSet = GetLocationSet(allLocations);
   std::vector<ItemLocation*> toAddBackItem;
   //Start at sphere before Ganon's and count down
   for (int i = playthroughLocations.size() - 2; i >= 0; i--) {
     //Check each item location in sphere
     std::vector<int> erasableIndices;
-    std::vector<ItemLocation*> sphere = playthroughLocations.at(i);
+    std::vector<ItemLocation*> sphere(playthroughLocations.at(i).begin(), playthroughLocations.at(i).end());
     for (int j = sphere.size() - 1; j >= 0; j--) {
       ItemLocation* location = sphere.at(j);
       Item copy = location->GetPlacedItem(); //Copy out item
       location->SetPlacedItem(NoItem); //Write in empty item
       playthroughBeatable = false;
       LogicReset();
-      GetAccessibleLocations(allLocations, CHECK_BEATABLE); //Check if game is still beatable
+      GetAccessibleLocations(allLocationSet, CHECK_BEATABLE); //Check if game is still beatable
       //Playthrough is still beatable without this item, therefore it can be removed from playthrough section.
       if (playthroughBeatable) {
         //Uncomment to print playthrough deletion log in citra
@@ -318,10 +335,11 @@ static void PareDownPlaythrough() {
   playthroughBeatable = true;
   //Do one last GetAccessibleLocations to avoid "NOT ADDED" in spoiler
   LogicReset();
-  GetAccessibleLocations(allLocations);
+  GetAccessibleLocations(allLocationSet);
 }
 
-static void FastFill(std::vector<Item> items, std::vector<ItemLocation*> locations) {
+//Consumes both items and locations
+static void FastFill(std::vector<Item>& items, std::vector<ItemLocation*>& locations) {
 
   //Place everything randomly
   while (!locations.empty()) {
@@ -334,6 +352,9 @@ static void FastFill(std::vector<Item> items, std::vector<ItemLocation*> locatio
   }
 }
 
+//Full restarts of AssumedFill before the phase it's in gets rolled back
+#define ASSUMED_FILL_ATTEMPTS 20
+
 /*
 | The algorithm places items in the world in reverse.
 | This means we first assume we have every item in the item pool and
@@ -341,21 +362,31 @@ static void FastFill(std::vector<Item> items, std::vector<ItemLocation*> locatio
 | This method helps distribution of items locked behind many requirements.
 | - OoT Randomizer
 */
-static void AssumedFill(std::vector<Item> items, std::vector<ItemLocation*> allowedLocations) {
+static bool AssumedFill(const std::vector<Item>& items, const std::vector<ItemLocation*>& allowedLocations) {
 
   if (items.size() > allowedLocations.size()) {
     printf("\x1b[H1;1ERROR: MORE ITEMS THAN LOCATIONS");
   }
 
-  //keep retrying to place everything until it works
+  const LocationSet allowedLocationSet = GetLocationSet(allowedLocations);
+
+  //keep retrying to place everything until it works, or give up and let the caller roll back
   bool unsuccessfulPlacement = false;
-  std::vector<ItemLocation*> attemptedLocations = {};
+  int attempts = 0;
+  std::vector<ItemLocation*>& attemptedLocations = fillScratch.attemptedLocations;
+  attemptedLocations.clear();
   do {
+    if (attempts++ == ASSUMED_FILL_ATTEMPTS) {
+      return false;
+    }
     unsuccessfulPlacement = false;
-    std::vector<Item> itemsToPlace = items;
+    std::vector<Item>& itemsToPlace = fillScratch.itemsToPlace;
+    itemsToPlace.assign(items.begin(), items.end());
 
     //copy all not yet placed advancement items so that we can apply their effects for the fill algorithm
-    std::vector<Item> itemsToNotPlace = FilterFromPool(ItemPool, [](const Item& i){ return i .IsAdvancement();});
+    std::vector<Item>& itemsToNotPlace = fillScratch.itemsToNotPlace;
+    itemsToNotPlace.clear();
+    std::copy_if(ItemPool.begin(), ItemPool.end(), std::back_inserter(itemsToNotPlace), [](const Item& i){ return i.IsAdvancement();});
 
     //shuffle the order of items to place
     Shuffle(itemsToPlace);
@@ -375,7 +406,7 @@ static void AssumedFill(std::vector<Item> items, std::vector<ItemLocation*> allo
       }
 
       //get all accessible locations that are allowed
-      std::vector<ItemLocation*> accessibleLocations = GetAccessibleLocations(allowedLocations);
+      std::vector<ItemLocation*>& accessibleLocations = GetAccessibleLocations(allowedLocationSet);
 
       //retry if there are no more locations to place items
       if (accessibleLocations.empty()) {
@@ -401,14 +432,15 @@ static void AssumedFill(std::vector<Item> items, std::vector<ItemLocation*> allo
 
       //place the item within one of the allowed locations
       ItemLocation* selectedLocation = RandomElement(accessibleLocations, false);
-      PlaceItemInLocation(selectedLocation, item);
+      PlaceItemInLocation(selectedLocation, std::move(item));
       attemptedLocations.push_back(selectedLocation);
 
     }
   } while (unsuccessfulPlacement);
+  return true;
 }
 
-static void RandomizeDungeonRewards() {
+static bool RandomizeDungeonRewards() {
 
   static constexpr std::array<u32, 9> bitMaskTable = {
     0x00040000,
@@ -426,7 +458,9 @@ static void RandomizeDungeonRewards() {
   if (ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON)) {
     //get stones and medallions
     std::vector<Item> rewards = FilterAndEraseFromPool(ItemPool, [](const Item& i) {return i.GetItemType() == ITEMTYPE_DUNGEONREWARD;});
-    AssumedFill(rewards, dungeonRewardLocations);
+    if (!AssumedFill(rewards, dungeonRewardLocations)) {
+      return false;
+    }
 
     for (size_t i = 0; i < dungeonRewardLocations.size(); i++) {
       const auto index = dungeonRewardLocations[i]->GetPlacedItem().GetItemID() - baseOffset;
@@ -447,6 +481,7 @@ static void RandomizeDungeonRewards() {
     //erase the stone/medallion from the Item Pool
     FilterAndEraseFromPool(ItemPool, [startingReward](const Item& i) {return i == startingReward;});
   }
+  return true;
 }
 
 static void FillExcludedLocations() {
@@ -460,8 +495,91 @@ static void FillExcludedLocations() {
   }
 }
 
+//Empty locations that are reachable when every item in the pool is assumed found.
+//No placement can ever use a location outside of this set.
+static LocationSet reachableLocations;
+
+static void UpdateReachableLocations() {
+  LogicReset();
+  for (Item& item : ItemPool) {
+    item.ApplyEffect();
+  }
+  reachableLocations = GetLocationSet(GetAccessibleLocations(GetLocationSet(allLocations)));
+  LogicReset();
+}
+
+//Upper bound on how many more items can be placed in these locations
+static int CountOpenLocations(const std::vector<ItemLocation*>& locations) {
+  return std::count_if(locations.begin(), locations.end(), [](ItemLocation* loc){
+    return reachableLocations[loc->GetId()] && loc->GetPlacedItem() == NoItem;
+  });
+}
+
+//Items that RandomizeOwnDungeon will have to place in this dungeon
+static bool IsOwnDungeonItem(const Dungeon::DungeonInfo* dungeon, const Item& item) {
+  if (Keysanity.Is(KEYSANITY_OWN_DUNGEON) && dungeon->GetSmallKey() != NoItem && item == dungeon->GetSmallKey()) {
+    return true;
+  }
+  if (((BossKeysanity.Is(BOSSKEYSANITY_OWN_DUNGEON) && dungeon->GetBossKey() != GanonsCastle_BossKey) ||
+       (GanonsBossKey.Is(GANONSBOSSKEY_OWN_DUNGEON) && dungeon->GetBossKey() == GanonsCastle_BossKey)) &&
+      item == dungeon->GetBossKey()) {
+    return true;
+  }
+  return MapsAndCompasses.Is(MAPSANDCOMPASSES_OWN_DUNGEON) && dungeon->GetMap() != NoItem && dungeon->GetCompass() != NoItem &&
+         (item == dungeon->GetMap() || item == dungeon->GetCompass());
+}
+
+static int CountOwnDungeonItems(const Dungeon::DungeonInfo* dungeon) {
+  return std::count_if(ItemPool.begin(), ItemPool.end(), [dungeon](const Item& i){ return IsOwnDungeonItem(dungeon, i);});
+}
+
+static std::vector<ItemLocation*> GetSongLocations() {
+  if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
+    return FilterFromPool(allLocations, [](ItemLocation * loc){ return loc->IsCategory(Category::cSong);});
+  } else if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
+    return FilterFromPool(allLocations, [](ItemLocation * loc){ return loc->IsCategory(Category::cSongDungeonReward);});
+  }
+  return {};
+}
+
+/*Before anything is placed, check that each group of items restricted to a set
+  of locations fits in the locations that could ever be reached. If a group
+  doesn't fit, no amount of retrying will help, so the fill can stop right away.*/
+static bool CheckFillCapacity() {
+  UpdateReachableLocations();
+
+  int failures = 0;
+  auto checkGroup = [&failures](std::string group, int items, int locations) {
+    if (items > locations) {
+      //one row per group, so every failing group stays on screen
+      printf("\x1b[%d;10HNot enough locations for %s", 10 + failures, group.c_str());
+      failures++;
+      PlacementLog_Msg("\nNOT ENOUGH LOCATIONS FOR ");
+      PlacementLog_Msg(group);
+      PlacementLog_Msg(": " + std::to_string(items) + " items, " + std::to_string(locations) + " locations\n");
+    }
+  };
+
+  if (ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
+    int songs = std::count_if(ItemPool.begin(), ItemPool.end(), [](const Item& i){ return i.GetItemType() == ITEMTYPE_SONG;});
+    checkGroup("Songs", songs, CountOpenLocations(GetSongLocations()));
+  }
+
+  for (auto dungeon : Dungeon::dungeonList) {
+    checkGroup(std::string(dungeon->GetName()), CountOwnDungeonItems(dungeon), CountOpenLocations(dungeon->GetDungeonLocations()));
+  }
+
+  //end of dungeon rewards go to dungeonRewardLocations, which aren't in allLocations
+  int advancementItems = std::count_if(ItemPool.begin(), ItemPool.end(), [](const Item& i){
+    return i.IsAdvancement() && !(i.GetItemType() == ITEMTYPE_DUNGEONREWARD && ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON));
+  });
+  checkGroup("Advancement Items", advancementItems, CountOpenLocations(allLocations));
+
+  return failures == 0;
+}
+
 //Function to handle the Own Dungeon setting
-static void RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
+static bool RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
   std::vector<ItemLocation*> dungeonLocations = dungeon->GetDungeonLocations();
   std::vector<Item> dungeonItems = {};
 
@@ -478,31 +596,47 @@ static void RandomizeOwnDungeon(const Dungeon::DungeonInfo* dungeon) {
   }
 
   //randomize boss key and small keys together for even distribution
-  AssumedFill(dungeonItems, dungeonLocations);
+  if (!AssumedFill(dungeonItems, dungeonLocations)) {
+    return false;
+  }
 
   //randomize map and compass separately since they're not progressive
   if (MapsAndCompasses.Is(MAPSANDCOMPASSES_OWN_DUNGEON) && dungeon->GetMap() != NoItem && dungeon->GetCompass() != NoItem) {
     auto dungeonMapAndCompass = FilterAndEraseFromPool(ItemPool, [dungeon](const Item& i){ return i == dungeon->GetMap() || i == dungeon->GetCompass();});
-    AssumedFill(dungeonMapAndCompass, dungeonLocations);
+    return AssumedFill(dungeonMapAndCompass, dungeonLocations);
+  }
+  return true;
+}
+
+//Dungeons with the fewest spare locations for their items are filled first,
+//while the most locations are still empty
+static bool RandomizeOwnDungeonItems() {
+  std::vector<std::pair<int, const Dungeon::DungeonInfo*>> dungeonsBySpareLocations;
+  for (auto dungeon : Dungeon::dungeonList) {
+    int spareLocations = CountOpenLocations(dungeon->GetDungeonLocations()) - CountOwnDungeonItems(dungeon);
+    dungeonsBySpareLocations.push_back({spareLocations, dungeon});
+  }
+  std::stable_sort(dungeonsBySpareLocations.begin(), dungeonsBySpareLocations.end(),
+                   [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first;});
+
+  for (auto& [spareLocations, dungeon] : dungeonsBySpareLocations) {
+    if (!RandomizeOwnDungeon(dungeon)) {
+      return false;
+    }
   }
+  return true;
 }
 
 /*Randomize items restricted to a certain set of locations.
   The fill order of location groups is as follows:
-    - Own Dungeon
-    - Any Dungeon
-    - Overworld
+    - Own Dungeon (RandomizeOwnDungeonItems)
+    - Any Dungeon and Overworld, the group with fewer spare locations first
   Small Keys, Gerudo Keys, Boss Keys, and/or Ganon's Boss Key will be randomized
   together if they have the same setting. Maps and Compasses are randomized
   separately once the dungeon advancement items have all been placed.*/
-static void RandomizeDungeonItems() {
+static bool RandomizeDungeonItems() {
   using namespace Dungeon;
 
-  //Own Dungeon
-  for (auto dungeon : dungeonList) {
-    RandomizeOwnDungeon(dungeon);
-  }
-
   //Get Any Dungeon and Overworld group locations
   std::vector<ItemLocation*> anyDungeonLocations = FilterFromPool(allLocations, [](ItemLocation* loc){return loc->IsDungeon();});
   //overworldLocations defined in item_location.cpp
@@ -553,20 +687,32 @@ static void RandomizeDungeonItems() {
     AddElementsToPool(overworldItems, rewards);
   }
 
-  //Randomize Any Dungeon and Overworld pools
-  AssumedFill(anyDungeonItems, anyDungeonLocations);
-  AssumedFill(overworldItems, overworldLocations);
+  //Randomize Any Dungeon and Overworld pools, the one with fewer spare locations first
+  const int anyDungeonSpareLocations = CountOpenLocations(anyDungeonLocations) - anyDungeonItems.size();
+  const int overworldSpareLocations = CountOpenLocations(overworldLocations) - overworldItems.size();
+  if (overworldSpareLocations < anyDungeonSpareLocations) {
+    if (!AssumedFill(overworldItems, overworldLocations) || !AssumedFill(anyDungeonItems, anyDungeonLocations)) {
+      return false;
+    }
+  } else if (!AssumedFill(anyDungeonItems, anyDungeonLocations) || !AssumedFill(overworldItems, overworldLocations)) {
+    return false;
+  }
 
   //Randomize maps and compasses after since they're not advancement items
   for (auto dungeon : dungeonList) {
     if (MapsAndCompasses.Is(MAPSANDCOMPASSES_OWN_DUNGEON)) {
       auto mapAndCompassItems = FilterAndEraseFromPool(ItemPool, [dungeon](const Item& i){return i == dungeon->GetMap() || i == dungeon->GetCompass();});
-      AssumedFill(mapAndCompassItems, anyDungeonLocations);
+      if (!AssumedFill(mapAndCompassItems, anyDungeonLocations)) {
+        return false;
+      }
     } else if (MapsAndCompasses.Is(MAPSANDCOMPASSES_OVERWORLD)) {
       auto mapAndCompassItems = FilterAndEraseFromPool(ItemPool, [dungeon](const Item& i){return i == dungeon->GetMap() || i == dungeon->GetCompass();});
-      AssumedFill(mapAndCompassItems, overworldLocations);
+      if (!AssumedFill(mapAndCompassItems, overworldLocations)) {
+        return false;
+      }
     }
   }
+  return true;
 }
 
 static void RandomizeLinksPocket() {
@@ -584,59 +730,231 @@ static void RandomizeLinksPocket() {
  }
 }
 
-int Fill() {
-  int retries = 0;
-  while(retries < 5) {
-    GenerateLocationPool();
-    GenerateItemPool();
-    GenerateStartingInventory();
-    RemoveStartingItemsFromPool();
-    FillExcludedLocations();
-    RandomizeDungeonRewards();
+static bool RandomizeSongs() {
+  //Place songs first if song shuffle is set to specific locations
+  if (ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
+
+    //Get each song
+    std::vector<Item> songs = FilterAndEraseFromPool(ItemPool, [](const Item& i) { return i.GetItemType() == ITEMTYPE_SONG;});
+
+    //Get each song location
+    std::vector<ItemLocation*> songLocations = GetSongLocations();
+
+    return AssumedFill(songs, songLocations);
+  }
+  return true;
+}
+
+//Places the remaining advancement items, fills the rest of the world, and
+//checks that the result is beatable
+static bool RandomizeRemainingItems() {
+  playthroughLocations.clear();
+  playthroughBeatable = false;
+
+  std::vector<Item> remainingAdvancementItems = FilterAndEraseFromPool(ItemPool, [](const Item& i) { return i.IsAdvancement();});
+  if (!AssumedFill(remainingAdvancementItems, allLocations)) {
+    return false;
+  }
 
-    //Place songs first if song shuffle is set to specific locations
-    if (ShuffleSongs.IsNot(SONGSHUFFLE_ANYWHERE)) {
+  //Fast fill for the rest of the pool
+  std::vector<Item> remainingPool = FilterAndEraseFromPool(ItemPool, [](const Item& i) {return true;});
+  LogicReset();
+  FastFill(remainingPool, GetAccessibleLocations(GetLocationSet(allLocations)));
 
-      //Get each song
-      std::vector<Item> songs = FilterAndEraseFromPool(ItemPool, [](const Item& i) { return i.GetItemType() == ITEMTYPE_SONG;});
+  LogicReset();
+  GeneratePlaythrough();
+  return playthroughBeatable;
+}
 
-      //Get each song location
-      std::vector<ItemLocation*> songLocations = {};
-      if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
-        songLocations = FilterFromPool(allLocations, [](ItemLocation * loc){ return loc->IsCategory(Category::cSong);});
+//Times a failing phase is rolled back and redone before restarting the whole fill
+#define FILL_PHASE_RETRIES 3
 
-      } else if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
-        songLocations = FilterFromPool(allLocations, [](ItemLocation * loc){ return loc->IsCategory(Category::cSongDungeonReward);});
+static FillRetryInfo fillRetryInfo;
+
+const FillRetryInfo& GetFillRetryInfo() {
+  return fillRetryInfo;
+}
+
+static LocationSet GetFilledLocations() {
+  LocationSet filledLocations;
+  for (ItemLocation* loc : allLocations) {
+    filledLocations[loc->GetId()] = loc->GetPlacedItem() != NoItem;
+  }
+  for (ItemLocation* loc : dungeonRewardLocations) {
+    filledLocations[loc->GetId()] = loc->GetPlacedItem() != NoItem;
+  }
+  return filledLocations;
+}
+
+//Remove every item placed since filledLocations was taken
+static void RollBackPlacements(const LocationSet& filledLocations) {
+  for (auto* locations : {&allLocations, &dungeonRewardLocations}) {
+    for (ItemLocation* loc : *locations) {
+      if (!filledLocations[loc->GetId()] && loc->GetPlacedItem() != NoItem) {
+        loc->RemovePlacedItem();
+        itemsPlaced--;
       }
+    }
+  }
+}
 
-      AssumedFill(songs, songLocations);
+static_assert(RANDOMSTREAM_FILL + FILLPHASE_MAX <= RANDOMSTREAM_MAX, "not enough random streams for the fill phases");
+
+/*Run one placement phase. The placed items and item pool are saved before
+  it starts, so if the phase fails only its own placements are undone and it
+  is redone with a different random stream instead of restarting the fill.
+  Each phase draws from its own stream, so one phase using more or fewer
+  random numbers doesn't change the phases after it.*/
+static bool RunFillPhase(FillPhase phase, bool (*placeItems)()) {
+  const LocationSet filledLocations = GetFilledLocations();
+  const std::vector<Item> itemPool = ItemPool;
+  const RandomStream stream = static_cast<RandomStream>(RANDOMSTREAM_FILL + phase);
+  const u64 startTick = svcGetSystemTick();
+
+  for (int retries = 0; ; retries++) {
+    Random_SelectStream(stream, (fillRetryInfo.fillAttempts << 8) | retries);
+    const bool placed = placeItems();
+    if (placed || retries == FILL_PHASE_RETRIES) {
+      fillRetryInfo.phaseTicks[phase] += svcGetSystemTick() - startTick;
+    }
+    if (placed) {
+      fillRetryInfo.maxPhaseRetries = std::max(fillRetryInfo.maxPhaseRetries, retries);
+      return true;
+    }
+    if (retries == FILL_PHASE_RETRIES) {
+      return false;
     }
 
-    //Then place dungeon items that are assigned to restrictive pools
-    RandomizeDungeonItems();
+    fillRetryInfo.phaseRollbacks++;
+    printf("\x1b[9;10HRetrying %s... %d", fillPhaseNames[phase], retries + 1);
+    PlacementLog_Msg("\nROLLING BACK ");
+    PlacementLog_Msg(fillPhaseNames[phase]);
+    PlacementLog_Msg("\n");
 
-    //Then place Link's Pocket Item if it has to be an advancement item
-    RandomizeLinksPocket();
+    RollBackPlacements(filledLocations);
+    ItemPool = itemPool;
+    LogicReset();
+  }
+}
 
-    //Then place the rest of the advancement items
-    std::vector<Item> remainingAdvancementItems = FilterAndEraseFromPool(ItemPool, [](const Item& i) { return i.IsAdvancement();});
-    AssumedFill(remainingAdvancementItems, allLocations);
+/*The location list, the base item pool, the fixed placements and shop prices
+  and the starting inventory only depend on the settings and which dungeons are
+  MQ, so the last ones built are kept. Seeds generated with the same settings,
+  and the settings check and every fill attempt of one seed, then only redo
+  the random part of the item pool.*/
+struct WorldTemplate {
+  std::string key; //empty when nothing is kept
+  std::vector<ItemLocation*> locations;
+  std::vector<Item> itemPool;
+  std::vector<Item> pendingJunkPool;
+  std::vector<ItemPoolDraw> draws;
+  std::vector<Item> startingInventory;
+  std::vector<std::tuple<ItemLocation*, Item, u16>> placements; //vanilla items and shop prices
+};
+static WorldTemplate worldTemplate;
+
+static std::string WorldTemplateKey() {
+  std::string key = GetSettingsString();
+  for (auto dungeon : Dungeon::dungeonList) {
+    key += dungeon->IsMQ() ? 'M' : 'V';
+  }
+  return key;
+}
 
-    //Fast fill for the rest of the pool
-    std::vector<Item> remainingPool = FilterAndEraseFromPool(ItemPool, [](const Item& i) {return true;});
-    LogicReset();
-    FastFill(remainingPool, GetAccessibleLocations(allLocations));
+static void SaveWorldTemplate(std::string key) {
+  worldTemplate.key = std::move(key);
+  worldTemplate.locations = allLocations;
+  worldTemplate.itemPool = ItemPool;
+  worldTemplate.pendingJunkPool = PendingJunkPool;
+  worldTemplate.draws = ItemPoolDraws;
+  worldTemplate.startingInventory = StartingInventory;
+  worldTemplate.placements.clear();
+  for (ItemLocation* loc : allLocations) {
+    if (loc->GetPlacedItem() != NoItem || loc->GetPrice() != 0) {
+      worldTemplate.placements.emplace_back(loc, loc->GetPlacedItem(), loc->GetPrice());
+    }
+  }
+}
+
+static void LoadWorldTemplate() {
+  allLocations = worldTemplate.locations;
+  for (auto& [loc, item, price] : worldTemplate.placements) {
+    if (item != NoItem) {
+      PlaceItemInLocation(loc, item);
+    }
+    loc->SetPrice(price);
+  }
+  ItemPool = worldTemplate.itemPool;
+  PendingJunkPool = worldTemplate.pendingJunkPool;
+  ItemPoolDraws = worldTemplate.draws;
+  StartingInventory = worldTemplate.startingInventory;
+}
+
+//Build the location and item pools for the current settings, with vanilla
+//placements done but nothing randomized yet. Each attempt gets a different item pool.
+void GenerateLocationAndItemPools(int attempt) {
+  std::string key = WorldTemplateKey();
+  if (worldTemplate.key == key) {
+    LoadWorldTemplate();
+  } else {
+    GenerateLocationPool();
+    GenerateBaseItemPool();
+    GenerateStartingInventory();
+    SaveWorldTemplate(std::move(key));
+  }
+
+  //Shop prices restart for every attempt too, so the settings check drawing
+  //the first attempt's pool doesn't change the prices the fill gets
+  Random_SelectStream(RANDOMSTREAM_PRICES, attempt - 1);
+  Random_SelectStream(RANDOMSTREAM_ITEM_POOL, attempt);
+  RandomizeItemPool();
+  RemoveStartingItemsFromPool();
+}
+
+int Fill() {
+  fillRetryInfo = {};
+  int retries = 0;
+  while(retries < 5) {
+    fillRetryInfo.fillAttempts++;
+    GenerateLocationAndItemPools(fillRetryInfo.fillAttempts);
+    FillExcludedLocations();
+
+    //Stop right away if some group of items can't possibly fit
+    if (!CheckFillCapacity()) {
+      return -1;
+    }
+
+    //Place songs first if song shuffle is set to specific locations,
+    //then dungeon items that are assigned to restrictive pools
+    bool placed = RunFillPhase(FILLPHASE_REWARDS, RandomizeDungeonRewards) &&
+                  RunFillPhase(FILLPHASE_SONGS, RandomizeSongs) &&
+                  RunFillPhase(FILLPHASE_OWN_DUNGEON, RandomizeOwnDungeonItems) &&
+                  RunFillPhase(FILLPHASE_ANY_DUNGEON, RandomizeDungeonItems);
+
+    if (placed) {
+      //Then place Link's Pocket Item if it has to be an advancement item
+      RandomizeLinksPocket();
+
+      //Then place the rest of the advancement items and check the result is beatable
+      placed = RunFillPhase(FILLPHASE_REMAINING, RandomizeRemainingItems);
+    }
 
-    LogicReset();
-    GeneratePlaythrough();
     //Successful placement, produced beatable result
-    if(playthroughBeatable) {
+    if(placed) {
       printf("Done");
       printf("\x1b[9;10HCalculating Playthrough...");
       PareDownPlaythrough();
       printf("Done");
       CreateOverrides();
       CreateAlwaysIncludedMessages();
+
+      PlacementLog_Msg("\nFill attempts: ");
+      PlacementLog_Msg(std::to_string(fillRetryInfo.fillAttempts));
+      PlacementLog_Msg("\nPhase rollbacks: ");
+      PlacementLog_Msg(std::to_string(fillRetryInfo.phaseRollbacks));
+      PlacementLog_Msg("\nMost retries for one phase: ");
+      PlacementLog_Msg(std::to_string(fillRetryInfo.maxPhaseRetries));
+      PlacementLog_Msg("\n");
       return 1;
     }
     //Unsuccessful placement
@@ -1,3 +1,32 @@
 #pragma once
 
+#include <3ds.h>
+
+enum FillPhase {
+  FILLPHASE_REWARDS,
+  FILLPHASE_SONGS,
+  FILLPHASE_OWN_DUNGEON,
+  FILLPHASE_ANY_DUNGEON,
+  FILLPHASE_REMAINING,
+  FILLPHASE_MAX,
+};
+
+constexpr const char* fillPhaseNames[FILLPHASE_MAX] = {
+  "Dungeon Rewards",
+  "Songs",
+  "Own Dungeon Items",
+  "Any Dungeon Items",
+  "Remaining Items",
+};
+
+//Retry counts and timings from the last call to Fill()
+struct FillRetryInfo {
+  int fillAttempts = 0;    //full restarts of the fill, counting the first one
+  int phaseRollbacks = 0;  //phases that were rolled back and redone
+  int maxPhaseRetries = 0; //most retries a single successful phase needed
+  u64 phaseTicks[FILLPHASE_MAX] = {}; //system ticks spent in each phase, retries included
+};
+
+void GenerateLocationAndItemPools(int attempt);
 extern int Fill();
+const FillRetryInfo& GetFillRetryInfo();
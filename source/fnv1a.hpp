@@ -0,0 +1,15 @@
+#pragma once
+
+#include <3ds.h>
+
+//32-bit FNV-1a. Unlike std::hash, this gives the same result on every platform and toolchain.
+constexpr u32 FNV_OFFSET_BASIS = 0x811C9DC5;
+
+template <typename Container>
+u32 Fnv1a(u32 hash, const Container& bytes) {
+  for (u8 byte : bytes) {
+    hash ^= byte;
+    hash *= 0x01000193;
+  }
+  return hash;
+}
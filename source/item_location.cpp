@@ -1,6 +1,7 @@
 #include "item_location.hpp"
 
 #include "dungeon.hpp"
+#include "seed_arena.hpp"
 #include "settings.hpp"
 #include "spoiler_log.hpp"
 
@@ -1288,10 +1289,12 @@ std::vector<ItemLocation*> overworldLocations = {
 std::vector<ItemLocation*> allLocations = {};
 std::vector<ItemLocation*> everyPossibleLocation = {};
 
+LocationSet locationsAddedToPool;
+
 //set of overrides to write to the patch
-std::set<ItemOverride, ItemOverride_Compare> overrides = {};
+std::pmr::set<ItemOverride, ItemOverride_Compare> overrides{SeedArena_Resource()};
 
-std::vector<std::vector<ItemLocation*>> playthroughLocations;
+std::pmr::vector<std::pmr::vector<ItemLocation*>> playthroughLocations{SeedArena_Resource()};
 bool playthroughBeatable = false;
 
 u16 itemsPlaced = 0;
@@ -1337,7 +1340,7 @@ void PlaceItemInLocation(ItemLocation* loc, Item item, bool applyEffectImmediate
     if (completion > 0.25) printf(".");
     if (completion > 0.50) printf(".");
 
-    loc->SetPlacedItem(item);
+    loc->SetPlacedItem(std::move(item));
 }
 
 //Same as PlaceItemInLocation, except a price is set as well as the item
@@ -1360,7 +1363,7 @@ void PlaceShopItemInLocation(ItemLocation* loc, Item item, u16 price, bool apply
     if (completion > 0.25) printf(".");
     if (completion > 0.50) printf(".");
 
-    loc->SetPlacedShopItem(item, price);
+    loc->SetPlacedShopItem(std::move(item), price);
 }
 
 std::vector<ItemLocation*> GetLocations(const std::vector<ItemLocation*>& locationPool, Category category) {
@@ -1373,14 +1376,16 @@ std::vector<ItemLocation*> GetLocations(const std::vector<ItemLocation*>& locati
   return locationsInCategory;
 }
 
-void LocationReset() {
-  for (ItemLocation* il : allLocations) {
-    il->RemoveFromPool();
+LocationSet GetLocationSet(const std::vector<ItemLocation*>& locationPool) {
+  LocationSet locationSet;
+  for (auto* loc : locationPool) {
+    locationSet[loc->GetId()] = true;
   }
+  return locationSet;
+}
 
-  for (ItemLocation * il : dungeonRewardLocations) {
-    il->RemoveFromPool();
-  }
+void LocationReset() {
+  locationsAddedToPool.reset();
 }
 
 void ItemReset() {
@@ -1395,6 +1400,13 @@ void ItemReset() {
   itemsPlaced = 0;
 }
 
+//Empties the overrides and playthrough so nothing still points into the seed arena
+void ClearSeedLocationData() {
+  overrides.clear();
+  decltype(playthroughLocations){SeedArena_Resource()}.swap(playthroughLocations);
+  playthroughBeatable = false;
+}
+
 //Fills everyPossibleLocation and creates an exclusion option for each location.
 //everyPossibleLocation is used in the menu to lock/hide excluding locations
 void AddExcludedOptions() {
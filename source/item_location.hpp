@@ -2,8 +2,10 @@
 
 #include <algorithm>
 #include <array>
+#include <bitset>
 #include <cstdio>
 #include <functional>
+#include <memory_resource>
 #include <set>
 #include <string>
 #include <unistd.h>
@@ -25,10 +27,27 @@ enum class ItemLocationType {
     TempleReward,
 };
 
+//Upper bound on ItemLocation ids, used to size LocationSet
+constexpr size_t LOCATIONS_MAX = 1024;
+//One bit per ItemLocation, indexed by ItemLocation::GetId()
+using LocationSet = std::bitset<LOCATIONS_MAX>;
+//Locations reached so far by the current access search
+extern LocationSet locationsAddedToPool;
+
 class ItemLocation {
 public:
     explicit ItemLocation(u8 scene_, ItemLocationType type_, u8 flag_, std::string name_, std::vector<Category> categories_, u16 price_ = 0)
-        : scene(scene_), type(type_), flag(flag_), name(std::move(name_)), categories(std::move(categories_)), price(price_) {}
+        : id(count++), scene(scene_), type(type_), flag(flag_), name(std::move(name_)), categories(std::move(categories_)),
+          excludedOption(Option::Bool(ExcludeOptionName(name), {"Include", "Exclude"}, {excludeOptionDescription})), price(price_) {}
+
+    //Number of ItemLocations that have been given an id
+    static u16 Count() {
+      return count;
+    }
+
+    u16 GetId() const {
+      return id;
+    }
 
     ItemOverride_Key Key() const {
         ItemOverride_Key key;
@@ -53,15 +72,15 @@ public:
     }
 
     bool IsAddedToPool() const {
-      return addedToPool;
+      return locationsAddedToPool[id];
     }
 
     void AddToPool() {
-      addedToPool = true;
+      locationsAddedToPool[id] = true;
     }
 
     void RemoveFromPool() {
-      addedToPool = false;
+      locationsAddedToPool[id] = false;
     }
 
     std::string_view GetName() const {
@@ -80,6 +99,12 @@ public:
       placedItem = std::move(item);
     }
 
+    //Undo placing an item here, used when a fill phase is rolled back
+    void RemovePlacedItem() {
+      used = false;
+      placedItem = NoItem;
+    }
+
     void SetPlacedShopItem(Item item, u16 price_) {
       placedItem = std::move(item);
       price = price_;
@@ -129,29 +154,8 @@ public:
       return &excludedOption;
     }
 
+    //The option itself is built with the location, this only adds it to the exclude menu
     void AddExcludeOption() {
-      //setting description  /*--------------------------------------------------*/
-      std::string_view desc = "Decide which locations you want to exclude from\n"
-                              "the location pool. Locations that require an item\n"
-                              "to be placed at them based on your current\n"
-                              "settings cannot be excluded and won't be shown\n"
-                              "unless you change your settings.\n"
-                              "\n"
-                              "If you exclude to many locations, it might not be\n"
-                              "possible to fill the world.";
-
-      //add option to forbid any location from progress items
-      if (name.length() < 23) {
-        excludedOption = Option::Bool(name, {"Include", "Exclude"}, {desc});
-      } else {
-        //insert a newline character if the text is too long for one row
-        size_t lastSpace = name.rfind(' ', 23);
-        std::string settingText = name;
-        settingText.replace(lastSpace, 1, "\n ");
-
-        excludedOption = Option::Bool(settingText, {"Include", "Exclude"}, {desc});
-      }
-
       Settings::excludeLocationsOptions.push_back(&excludedOption);
     }
 
@@ -186,13 +190,37 @@ public:
     void ResetVariables() {
       used = false;
       checked = false;
-      addedToPool = false;
+      RemoveFromPool();
       placedItem = NoItem;
       delayedItem = NoItem;
       price = 0;
     }
 
 private:
+    //setting description                                        /*--------------------------------------------------*/
+    static constexpr std::string_view excludeOptionDescription = "Decide which locations you want to exclude from\n"
+                                                                 "the location pool. Locations that require an item\n"
+                                                                 "to be placed at them based on your current\n"
+                                                                 "settings cannot be excluded and won't be shown\n"
+                                                                 "unless you change your settings.\n"
+                                                                 "\n"
+                                                                 "If you exclude to many locations, it might not be\n"
+                                                                 "possible to fill the world.";
+
+    static std::string ExcludeOptionName(const std::string& locationName) {
+      if (locationName.length() < 23) {
+        return locationName;
+      }
+      //insert a newline character if the text is too long for one row
+      size_t lastSpace = locationName.rfind(' ', 23);
+      std::string settingText = locationName;
+      settingText.replace(lastSpace, 1, "\n ");
+      return settingText;
+    }
+
+    static inline u16 count = 0;
+
+    u16 id;
     u8 scene;
     ItemLocationType type;
     u8 flag;
@@ -201,10 +229,9 @@ private:
 
     std::string name;
     std::vector<Category> categories;
-    bool addedToPool = false;
     Item placedItem = NoItem;
     Item delayedItem = NoItem;
-    Option excludedOption = Option::Bool(name, {"Include", "Exclude"}, {"", ""});
+    Option excludedOption;
     u16 price = 0;
 
 };
@@ -1060,9 +1087,9 @@ extern std::vector<ItemLocation *> allLocations;
 extern std::vector<ItemLocation *> everyPossibleLocation;
 
 //set of overrides to write to the patch
-extern std::set<ItemOverride, ItemOverride_Compare> overrides;
+extern std::pmr::set<ItemOverride, ItemOverride_Compare> overrides;
 
-extern std::vector<std::vector<ItemLocation*>> playthroughLocations;
+extern std::pmr::vector<std::pmr::vector<ItemLocation*>> playthroughLocations;
 extern bool playthroughBeatable;
 
 extern u16 itemsPlaced;
@@ -1071,7 +1098,9 @@ void GenerateLocationPool();
 void PlaceItemInLocation(ItemLocation* loc, Item item, bool applyEffectImmediately = false);
 void PlaceShopItemInLocation(ItemLocation* loc, Item item, u16 price, bool applyEffectImmediately = false);
 std::vector<ItemLocation*> GetLocations(const std::vector<ItemLocation*>& locationPool, Category category);
+LocationSet GetLocationSet(const std::vector<ItemLocation*>& locationPool);
 void LocationReset();
 void ItemReset();
+void ClearSeedLocationData();
 void AddExcludedOptions();
 void CreateOverrides();
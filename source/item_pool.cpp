@@ -14,6 +14,7 @@ using namespace Dungeon;
 
 std::vector<Item> ItemPool = {};
 std::vector<Item> PendingJunkPool = {};
+std::vector<ItemPoolDraw> ItemPoolDraws = {};
 std::vector<Item> dungeonRewards = {
   I_KokiriEmerald,
   I_GoronRuby,
@@ -452,8 +453,13 @@ static void AddItemToMainPool(const Item& item, size_t count = 1) {
   ItemPool.insert(ItemPool.end(), count, item);
 }
 
-static void AddRandomBottle(std::vector<Item>& bottlePool) {
-  AddItemToMainPool(RandomElement(bottlePool, true));
+//Leave a slot in the pool (or a point in the draw order, for shops) that
+//RandomizeItemPool fills in later
+static void AddPoolDraw(PoolDraw type) {
+  ItemPoolDraws.push_back({type, static_cast<u16>(ItemPool.size())});
+  if (type != PoolDraw::Shops) {
+    AddItemToMainPool(NoItem);
+  }
 }
 
 Item GetJunkItem() {
@@ -604,7 +610,23 @@ static int GetShopsanityReplaceAmount() {
 
 //OoTR uses a fancy betavariate function for a weighted distribution in [0, 300] in increments of 5... For now each price is just equally likely
 static int GetRandomShopPrice() {
-  return Random(0, 61) * 5;
+  return RandomFromStream(RANDOMSTREAM_PRICES, 0, 61) * 5;
+}
+
+static void ShuffleShopItems() {
+  SetVanillaShopItems();
+  Shuffle(ShopItems); //Shuffle shop items amongst themselves
+  PlaceShopItems(); //Place now-shuffled shop items
+  if (Settings::Shopsanity.IsNot(SHOPSANITY_ZERO)) { //Shopsanity 1-4, random
+    //Overwrite appropriate number of shop items
+    const std::array<int, 4> indices = {7, 5, 8, 6}; //Indices from OoTR
+    for (size_t i = 0; i < ShopLocationLists.size(); i++) {
+      int num_to_replace = GetShopsanityReplaceAmount(); //1-4 shop items will be overwritten, depending on settings
+      for(int j = 0; j < num_to_replace; j++) {
+        ShopLocationLists[i][indices[j]-1]->SetPlacedShopItem(NoItem, GetRandomShopPrice()); //Clear item and put a random price
+      }
+    }
+  }
 }
 
 static void PlaceVanillaDekuScrubItems() {
@@ -734,9 +756,16 @@ static void SetMinimalItemPool() {
   ReplaceMaxItem(HeartContainer, 0);
 }
 
-void GenerateItemPool() {
+/*Everything in the item pool that only depends on the settings: the fixed
+  and vanilla placements, the pending junk and the pool itself. Every item
+  that needs a random number is left as a placeholder recorded in
+  ItemPoolDraws, so the result can be kept and reused for any seed with the
+  same settings.*/
+void GenerateBaseItemPool() {
 
   ItemPool.clear();
+  PendingJunkPool.clear();
+  ItemPoolDraws.clear();
 
   //Fixed item locations
   PlaceItemInLocation(&HC_ZeldasLetter, I_ZeldasLetter);
@@ -768,11 +797,11 @@ void GenerateItemPool() {
   if (ShuffleCows) {
     //9 total cow locations
     for (u8 i = 0; i < 9; i++) {
-      AddItemToMainPool(GetJunkItem());
+      AddPoolDraw(PoolDraw::Junk);
     }
     //extra location for Jabu MQ
     if (JabuJabusBelly.IsMQ()) {
-      AddItemToMainPool(GetJunkItem());
+      AddPoolDraw(PoolDraw::Junk);
     }
   } else {
     PlaceVanillaCowMilk();
@@ -911,20 +940,11 @@ void GenerateItemPool() {
     }
     AddItemsToPool(ItemPool, normalRupees);
   } else {
-    Shuffle(ShopItems); //Shuffle shop items amongst themselves
-    PlaceShopItems(); //Place now-shuffled shop items
+    AddPoolDraw(PoolDraw::Shops);
     if (Settings::Shopsanity.Is(SHOPSANITY_ZERO)) { //Shopsanity 0
       AddItemsToPool(ItemPool, normalRupees);
     } 
     else { //Shopsanity 1-4, random
-      //Overwrite appropriate number of shop items
-      const std::array<int, 4> indices = {7, 5, 8, 6}; //Indices from OoTR
-      for (size_t i = 0; i < ShopLocationLists.size(); i++) {
-        int num_to_replace = GetShopsanityReplaceAmount(); //1-4 shop items will be overwritten, depending on settings
-        for(int j = 0; j < num_to_replace; j++) {
-          ShopLocationLists[i][indices[j]-1]->SetPlacedShopItem(NoItem, GetRandomShopPrice()); //Clear item and put a random price
-        }
-      }
       AddItemsToPool(ItemPool, shopsanityRupees); //Shopsanity gets extra large rupees
     }
   }
@@ -963,11 +983,7 @@ void GenerateItemPool() {
 
     //I'm not sure what this is for, but it was in ootr so I copied it
     for (u8 i = 0; i < 7; i++) {
-      if (Random(0, 3)) {
-        AddItemToMainPool(Arrows30);
-      } else {
-        AddItemToMainPool(DekuSeeds30);
-      }
+      AddPoolDraw(PoolDraw::ScrubAmmo);
     }
   } else {
     PlaceVanillaDekuScrubItems();
@@ -1031,12 +1047,9 @@ void GenerateItemPool() {
 
   //Add 4 total bottles
   u8 bottleCount = 4;
-  std::vector<Item> bottles;
-  bottles.assign(normalBottles.begin(), normalBottles.end());
-
   for (u8 i = 0; i < bottleCount; i++) {
     if (i >= rutoBottles) {
-      AddRandomBottle(bottles);
+      AddPoolDraw(PoolDraw::Bottle);
     } else {
       AddItemToMainPool(I_RutosLetter);
     }
@@ -1107,6 +1120,30 @@ void GenerateItemPool() {
   } else {
     AddItemsToPool(ItemPool, normalItems);
   }
+}
+
+//Fill in the placeholders left by GenerateBaseItemPool in the order they were
+//added, then make the replacements that depend on what was drawn
+void RandomizeItemPool() {
+  std::vector<Item> bottles;
+  bottles.assign(normalBottles.begin(), normalBottles.end());
+
+  for (const ItemPoolDraw& draw : ItemPoolDraws) {
+    switch (draw.type) {
+      case PoolDraw::Junk:
+        ItemPool[draw.index] = GetJunkItem();
+        break;
+      case PoolDraw::ScrubAmmo:
+        ItemPool[draw.index] = Random(0, 3) ? Arrows30 : DekuSeeds30;
+        break;
+      case PoolDraw::Bottle:
+        ItemPool[draw.index] = RandomElement(bottles, true);
+        break;
+      case PoolDraw::Shops:
+        ShuffleShopItems();
+        break;
+    }
+  }
 
   if (!ShuffleKokiriSword) {
     ReplaceMaxItem(I_KokiriSword, 0);
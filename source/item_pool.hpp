@@ -1,17 +1,34 @@
 #pragma once
 
+#include <3ds.h>
 #include <cstddef>
 #include <vector>
 
 class Item;
 class ItemLocation;
 
+//What a placeholder left by GenerateBaseItemPool turns into
+enum class PoolDraw : u8 {
+  Junk,      //any junk item
+  ScrubAmmo, //arrows or seeds
+  Bottle,    //a bottle not drawn yet
+  Shops,     //no slot, shuffles the shop items at this point in the draw order
+};
+
+struct ItemPoolDraw {
+  PoolDraw type;
+  u16 index; //into ItemPool
+};
+
 void AddItemToPool(std::vector<Item>& pool, const Item& item, size_t count = 1);
 Item GetJunkItem();
 void PlaceJunkInExcludedLocation(ItemLocation* il);
-void GenerateItemPool();
+void GenerateBaseItemPool();
+void RandomizeItemPool();
 void AddJunk();
 
 extern std::vector<Item> AdvancementItemPool;
 extern std::vector<Item> ItemPool;
+extern std::vector<Item> PendingJunkPool;
+extern std::vector<ItemPoolDraw> ItemPoolDraws;
 extern std::vector<Item> dungeonRewards;
@@ -7,11 +7,14 @@
 #include <cstring>
 #include <ctime>
 
+#include "console_buffer.hpp"
 #include "cosmetics.hpp"
+#include "item_location.hpp"
 #include "menu.hpp"
 #include "patch.hpp"
 #include "preset.hpp"
 #include "randomizer.hpp"
+#include "seed_digest.hpp"
 #include "settings.hpp"
 #include "spoiler_log.hpp"
 
@@ -33,23 +36,34 @@ namespace {
   MenuItem* currentSubMenuItem;
   Option* currentSetting;
   PrintConsole topScreen, bottomScreen;
+  ConsoleBuffer topBuffer{TOP_WIDTH};
+  ConsoleBuffer bottomBuffer{BOTTOM_WIDTH};
   std::vector<std::string> presetEntries;
 }
 
 void PrintTopScreen() {
-  consoleSelect(&topScreen);
-  consoleClear();
-  printf("\x1b[2;11H%sOcarina of Time 3D Randomizer%s", CYAN, RESET);
-  printf("\x1b[3;18H%s%s%s", CYAN, RANDOMIZER_VERSION, RESET);
-  printf("\x1b[4;10HA/B/D-pad: Navigate Menu\n");
-  printf("            Select: Exit to Homebrew Menu\n");
-  printf("                 Y: New Random Seed\n");
-  printf("                 X: Input Custom Seed\n");
-  printf("\x1b[11;7HCurrent Seed: %s", Settings::seed.c_str());
+  topBuffer.Clear();
+  topBuffer.Print(2, 11, "Ocarina of Time 3D Randomizer", CellColor::Cyan);
+  topBuffer.Print(3, 18, RANDOMIZER_VERSION, CellColor::Cyan);
+  topBuffer.Print(4, 10, "A/B/D-pad: Navigate Menu");
+  topBuffer.Print(5, 12, "Select: Exit to Homebrew Menu");
+  topBuffer.Print(6, 17, "Y: New Random Seed");
+  topBuffer.Print(7, 17, "X: Input Custom Seed");
+  topBuffer.Print(11, 7, "Current Seed: " + Settings::seed);
 }
 
 void MenuInit() {
 
+  //Location ids index fixed size bitsets and arrays, so with more locations than
+  //they hold nothing can run safely. Say so and leave only Select working.
+  if (ItemLocation::Count() > LOCATIONS_MAX) {
+    consoleInit(GFX_TOP, &topScreen);
+    printf("\x1b[10;5HERROR: %d locations, LOCATIONS_MAX is %d.", ItemLocation::Count(), static_cast<int>(LOCATIONS_MAX));
+    printf("\x1b[12;5HPress Select to exit.");
+    mode = LOCATION_LIMIT_ERROR;
+    return;
+  }
+
   Settings::SetDefaultSettings();
 
   seedChanged = false;
@@ -72,28 +86,30 @@ void MenuInit() {
   consoleInit(GFX_TOP,    &topScreen);
   consoleInit(GFX_BOTTOM, &bottomScreen);
 
-  consoleSelect(&topScreen);
-
-  if (!CreatePresetDirectories()) {
-    printf("\x1b[20;5Failed to create preset directories.");
-    printf("\x1b[21;5Loading presets might crash.");
-  }
+  const bool presetDirectoriesCreated = CreatePresetDirectories();
 
   //If cached presets exist, load them
   LoadCachedSettings();
   LoadCachedCosmetics();
 
   PrintTopScreen();
+  if (!presetDirectoriesCreated) {
+    topBuffer.Print(20, 5, "Failed to create preset directories.");
+    topBuffer.Print(21, 5, "Loading presets might crash.");
+  }
+  consoleSelect(&topScreen);
+  topBuffer.Flush();
 
   consoleSelect(&bottomScreen);
   PrintMainMenu();
-
+  bottomBuffer.Flush();
 }
 
 void MenuUpdate(u32 kDown) {
 
-  consoleSelect(&bottomScreen);
-  consoleClear();
+  if (mode == LOCATION_LIMIT_ERROR) {
+    return;
+  }
 
   //Check for a main menu change
   if (kDown & KEY_A && mode == MAIN_MENU) {
@@ -101,7 +117,6 @@ void MenuUpdate(u32 kDown) {
     ModeChangeInit();
     kDown = 0;
   } else if ((kDown & KEY_B && mode != MAIN_MENU && subMode != SUB_MENU)) {
-    consoleSelect(&topScreen);
     PrintTopScreen();
     mode = MAIN_MENU;
     currentMenuItem = Settings::mainMenu[menuIdx];
@@ -138,17 +153,23 @@ void MenuUpdate(u32 kDown) {
 
     //Reprint seed if it changed
     if (seedChanged) {
-      std::string spaces = "";
-      spaces.append(pastSeedLength, ' ');
-      consoleSelect(&topScreen);
-      printf("\x1b[11;21H%s", spaces.c_str());
-      printf("\x1b[11;21H%s", Settings::seed.c_str());
+      topBuffer.Print(11, 21, std::string(pastSeedLength, ' '));
+      topBuffer.Print(11, 21, Settings::seed);
       seedChanged = false;
     }
   }
 
-  //Print current menu (if applicable)
+  //Menus are drawn into bottomBuffer and only the changed cells get printed,
+  //everything else clears the screen and prints directly
   consoleSelect(&bottomScreen);
+  if (mode == MAIN_MENU || mode == OPTION_SUB_MENU || mode == SUB_MENU) {
+    bottomBuffer.Clear();
+  } else {
+    consoleClear();
+    bottomBuffer.Invalidate();
+  }
+
+  //Print current menu (if applicable)
   if (mode == MAIN_MENU) {
     UpdateMainMenu(kDown);
     PrintMainMenu();
@@ -171,6 +192,18 @@ void MenuUpdate(u32 kDown) {
     UpdateSubMenu(kDown);
     PrintSubMenu();
   }
+
+  if (mode == MAIN_MENU || mode == OPTION_SUB_MENU || mode == SUB_MENU) {
+    consoleSelect(&bottomScreen);
+    bottomBuffer.Flush();
+  }
+
+  //The top screen is kept in topBuffer, except for the generation output
+  //printed over it until B goes back to the menu
+  if (mode != POST_GENERATE) {
+    consoleSelect(&topScreen);
+    topBuffer.Flush();
+  }
 }
 
 void ModeChangeInit() {
@@ -195,12 +228,11 @@ void ModeChangeInit() {
   } else if (mode == SAVE_PRESET) {
     ClearDescription();
     if (SaveSpecifiedPreset(GetInput("Preset Name").substr(0, 19), OptionCategory::Setting)) {
-      printf("\x1b[24;5HPreset Saved!");
-      printf("\x1b[26;5HPress B to return to the preset menu.");
+      topBuffer.Print(24, 5, "Preset Saved!");
     } else {
-      printf("\x1b[24;5HFailed to save preset.");
-      printf("\x1b[26;5HPress B to return to the preset menu.");
+      topBuffer.Print(24, 5, "Failed to save preset.");
     }
+    topBuffer.Print(26, 5, "Press B to return to the preset menu.");
 
   } else if (mode == LOAD_PRESET || mode == DELETE_PRESET) {
     presetEntries = GetSettingsPresets();
@@ -312,14 +344,17 @@ void UpdatePresetsMenu(u32 kDown) {
     presetIdx = static_cast<u8>(presetEntries.size() - 1);
   }
 
-  consoleSelect(&topScreen);
   //clear any potential message
   ClearDescription();
   if ((kDown & KEY_A) != 0 && mode == LOAD_PRESET) {
     if (LoadPreset(presetEntries[presetIdx], OptionCategory::Setting)) {
-      printf("\x1b[24;5HPreset Loaded!");
+      topBuffer.Print(24, 5, "Preset Loaded!");
+      const PresetLoadReport& report = GetPresetLoadReport();
+      if (report.unknownSettings > 0 || report.unknownValues > 0) {
+        topBuffer.Print(25, 5, "Skipped " + std::to_string(report.unknownSettings) + " old settings, " + std::to_string(report.unknownValues) + " old values.");
+      }
     } else {
-      printf("\x1b[24;5HFailed to load preset.");
+      topBuffer.Print(24, 5, "Failed to load preset.");
     }
   } else if ((kDown & KEY_A) != 0 && mode == DELETE_PRESET) {
     if (DeletePreset(presetEntries[presetIdx], OptionCategory::Setting)) {
@@ -327,9 +362,9 @@ void UpdatePresetsMenu(u32 kDown) {
       if(presetIdx == presetEntries.size()) { //Catch when last preset is deleted
         presetIdx--;
       }
-      printf("\x1b[24;5HPreset Deleted.");
+      topBuffer.Print(24, 5, "Preset Deleted.");
     } else {
-      printf("\x1b[24;5HFailed to delete preset.");
+      topBuffer.Print(24, 5, "Failed to delete preset.");
     }
   }
 }
@@ -354,7 +389,7 @@ void UpdateGenerateMenu(u32 kDown) {
 }
 
 void PrintMainMenu() {
-  printf("\x1b[0;%dHMain Settings Menu", (BOTTOM_WIDTH/2) - 9);
+  bottomBuffer.Print(0, (BOTTOM_WIDTH/2) - 9, "Main Settings Menu");
 
   for (u8 i = 0; i < MAX_SETTINGS_ON_SCREEN; i++) {
     if (i + menuBound >= Settings::mainMenu.size()) break;
@@ -364,81 +399,54 @@ void PrintMainMenu() {
     u8 row = 3 + i;
     //make the current menu green
     if (menuIdx == i + menuBound) {
-      printf("\x1b[%d;%dH%s>",  row,  2, GREEN);
-      printf("\x1b[%d;%dH%s%s", row,  3, menu->name.c_str(), RESET);
+      bottomBuffer.Print(row, 2, ">", CellColor::Green);
+      bottomBuffer.Print(row, 3, menu->name, CellColor::Green);
     } else {
-      printf("\x1b[%d;%dH%s",   row,  3, menu->name.c_str());
+      bottomBuffer.Print(row, 3, menu->name);
     }
   }
 }
 
 void PrintOptionSubMenu() {
-  //bounds checking incase settings go off screen
-  //this is complicated to account for hidden settings and there's probably a better way to do it
-  u16 hiddenSettings = 0;
-  u16 visibleSettings = 0;
-  for (u16 i = settingBound; visibleSettings < MAX_SETTINGS_ON_SCREEN; i++) {
-    if (i >= currentMenuItem->settingsList->size()) {
-      break;
-    }
-    if (currentMenuItem->settingsList->at(i)->IsHidden()) {
-      hiddenSettings++;
-    } else {
-      visibleSettings++;
-    }
-  }
-  if (settingIdx >= settingBound + MAX_SETTINGS_ON_SCREEN + hiddenSettings) {
-    settingBound = settingIdx;
-    u8 offset = 0;
-    //skip over hidden settings
-    while (offset < MAX_SETTINGS_ON_SCREEN - 1) {
-      settingBound--;
-      if (settingBound == 0) {
-        break;
-      }
-      offset += currentMenuItem->settingsList->at(settingBound)->IsHidden() ? 0 : 1;
-    }
-  } else if (settingIdx < settingBound)  {
-    settingBound = settingIdx;
+  //only settings that aren't hidden take up space in the list
+  const std::vector<u16>& visibleSettings = currentMenuItem->GetVisibleSettings();
+
+  //bounds checking incase settings go off screen, settingBound is a position in visibleSettings
+  u16 visibleIdx = std::lower_bound(visibleSettings.begin(), visibleSettings.end(), settingIdx) - visibleSettings.begin();
+  if (visibleIdx >= settingBound + MAX_SETTINGS_ON_SCREEN) {
+    settingBound = visibleIdx - (MAX_SETTINGS_ON_SCREEN - 1);
+  } else if (visibleIdx < settingBound) {
+    settingBound = visibleIdx;
   }
 
   //print menu name
-  printf("\x1b[0;%dH%s", (BOTTOM_WIDTH/2) - (currentMenuItem->name.length()/2), currentMenuItem->name.c_str());
+  bottomBuffer.Print(0, (BOTTOM_WIDTH/2) - (currentMenuItem->name.length()/2), currentMenuItem->name);
 
-  //keep count of hidden settings to not make blank spaces appear in the list
-  hiddenSettings = 0;
-
-  for (u8 i = 0; i - hiddenSettings < MAX_SETTINGS_ON_SCREEN; i++) {
+  for (u8 i = 0; i < MAX_SETTINGS_ON_SCREEN; i++) {
     //break if there are no more settings to print
-    if (i + settingBound >= currentMenuItem->settingsList->size()) break;
+    if (i + settingBound >= visibleSettings.size()) break;
 
-    Option* setting = currentMenuItem->settingsList->at(i + settingBound);
+    u16 idx = visibleSettings[i + settingBound];
+    Option* setting = currentMenuItem->settingsList->at(idx);
 
-    u8 row = 3 + ((i - hiddenSettings) * 2);
-    //make the current setting green
-    if (settingIdx == i + settingBound) {
-      printf("\x1b[%d;%dH%s>",   row,  1, GREEN);
-      printf("\x1b[%d;%dH%s:",   row,  2, setting->GetName().data());
-      printf("\x1b[%d;%dH%s%s",  row, 26, setting->GetSelectedOptionText().data(), RESET);
-    //dim to make a locked setting grey
+    u8 row = 3 + (i * 2);
+    //make the current setting green, dim to make a locked setting grey
+    CellColor color = CellColor::Normal;
+    if (settingIdx == idx) {
+      color = CellColor::Green;
+      bottomBuffer.Print(row, 1, ">", color);
     } else if (setting->IsLocked()) {
-      printf("\x1b[%d;%dH%s%s:", row,  2, DIM, setting->GetName().data());
-      printf("\x1b[%d;%dH%s%s",  row, 26, setting->GetSelectedOptionText().data(), RESET);
-    //don't display hidden settings
-    } else if (setting->IsHidden()) {
-      hiddenSettings++;
-      continue;
-    } else {
-      printf("\x1b[%d;%dH%s:",   row,  2, setting->GetName().data());
-      printf("\x1b[%d;%dH%s",    row, 26, setting->GetSelectedOptionText().data());
+      color = CellColor::Dim;
     }
+    bottomBuffer.Print(row,  2, std::string(setting->GetName()).append(":"), color);
+    bottomBuffer.Print(row, 26, setting->GetSelectedOptionText(), color);
   }
 
   PrintOptionDescrption();
 }
 
 void PrintSubMenu() {
-  printf("\x1b[0;%dH%s Menu", (BOTTOM_WIDTH/2) - 9, currentMenuItem->name.c_str());
+  bottomBuffer.Print(0, (BOTTOM_WIDTH/2) - 9, currentMenuItem->name + " Menu");
 
   for (u8 i = 0; i < MAX_SETTINGS_ON_SCREEN; i++) {
     if (i + menuBound >= currentMenuItem->itemsList->size()) break;
@@ -446,10 +454,10 @@ void PrintSubMenu() {
     u8 row = 3 + i;
     //make the current menu green
     if (itemIdx == i + menuBound) {
-      printf("\x1b[%d;%dH%s>",  row,  2, GREEN);
-      printf("\x1b[%d;%dH%s%s", row,  3, currentMenuItem->itemsList->at(i)->name.c_str(), RESET);
+      bottomBuffer.Print(row, 2, ">", CellColor::Green);
+      bottomBuffer.Print(row, 3, currentMenuItem->itemsList->at(i)->name, CellColor::Green);
     } else {
-      printf("\x1b[%d;%dH%s",   row,  3, currentMenuItem->itemsList->at(i)->name.c_str());
+      bottomBuffer.Print(row, 3, currentMenuItem->itemsList->at(i)->name);
     }
   }
 }
@@ -506,25 +514,20 @@ void PrintGenerateMenu() {
 }
 
 void ClearDescription() {
-  consoleSelect(&topScreen);
-
   //clear the previous description
-  std::string spaces = "";
-  spaces.append(9 * TOP_WIDTH, ' ');
-  printf("\x1b[22;0H%s", spaces.c_str());
+  topBuffer.ClearRows(22, SCREEN_HEIGHT - 22);
 }
 
 void PrintOptionDescrption() {
   ClearDescription();
-  std::string_view description = currentSetting->GetSelectedOptionDescription();
-
-  printf("\x1b[22;0H%s", description.data());
+  topBuffer.Print(22, 0, currentSetting->GetSelectedOptionDescription());
 }
 
 void GenerateRandomizer() {
 
   consoleSelect(&topScreen);
   consoleClear();
+  topBuffer.Invalidate();
   printf("\x1b[7;10HCaching Settings...");
 
   //After choosing to generate, cache chosen settings for later
@@ -539,25 +542,12 @@ void GenerateRandomizer() {
     const int count = std::stoi(Settings::seed.substr(18), nullptr);
     Playthrough::Playthrough_Repeat(count);
     return;
+  } else if (Settings::seed == "seed_digest_check") {
+    SeedDigest_CheckCorpus();
+    return;
   }
 
-  //turn the settings into a string for hashing
-  std::string settingsStr;
-  for (MenuItem* menu : Settings::mainMenu) {
-    //don't go through non-menus
-    if (menu->mode != OPTION_SUB_MENU) {
-      continue;
-    }
-
-    for (size_t i = 0; i < menu->settingsList->size(); i++) {
-      Option* setting = menu->settingsList->at(i);
-      if (setting->IsCategory(OptionCategory::Setting)) {
-        settingsStr += setting->GetSelectedOptionText();
-      }
-    }
-  }
-
-  unsigned int finalHash = std::hash<std::string>{}(Settings::seed + settingsStr);
+  u32 finalHash = Settings::GetSeedHash(Settings::seed);
 
   int ret = Playthrough::Playthrough_Init(finalHash);
   if (ret < 0) {
@@ -565,6 +555,10 @@ void GenerateRandomizer() {
       printf("\n\nFailed to generate after 5 tries.\nPress Select to exit or B to go back to the menu.\n");
       return;
     }
+    else if(ret == -2) { //Settings can't produce any seed
+      printf("\n\nChange the settings above and try again.\nPress Select to exit or B to go back to the menu.\n");
+      return;
+    }
     else {
       printf("\n\nError %d with fill.\nPress Select to exit or B to go back to the menu.\n", ret);
       return;
@@ -11,6 +11,7 @@
 #define SAVE_PRESET 5
 #define DELETE_PRESET 6
 #define POST_GENERATE 7
+#define LOCATION_LIMIT_ERROR 8
 #define MAX_SETTINGS_ON_SCREEN 13
 #define TOP_WIDTH 50
 #define BOTTOM_WIDTH 40
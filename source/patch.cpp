@@ -2,8 +2,10 @@
 
 #include "cosmetics.hpp"
 #include "custom_messages.hpp"
+#include "../code/src/override_table.h"
 
 #include <array>
+#include <cstddef>
 #include <cstring>
 #include <fstream>
 #include <memory>
@@ -89,8 +91,16 @@ bool WritePatch() {
   }
   totalRW += 3;
 
-  // Write override table size to code
-  const u32 ovrTableSize = sizeof(ItemOverride) * overrides.size();
+  // Bucket the overrides by scene, the set is already in key order
+  const std::vector<ItemOverride> sortedOverrides(overrides.begin(), overrides.end());
+  auto ovrTable = std::make_unique<OverrideTable>();
+  if (!OverrideTable_Encode(ovrTable.get(), sortedOverrides.data(), sortedOverrides.size())) {
+    printf("\nOverride table encoding failed: %u overrides\n", static_cast<unsigned int>(sortedOverrides.size()));
+    return false;
+  }
+
+  // Write override table size to code, only the used part of the entries
+  const u32 ovrTableSize = offsetof(OverrideTable, entries) + sizeof(PackedOverride) * OverrideTable_Count(ovrTable.get());
   buf[0] = (ovrTableSize >> 8) & 0xFF;
   buf[1] = (ovrTableSize) & 0xFF;
   if (!R_SUCCEEDED(res = FSFILE_Write(code, &bytesWritten, totalRW, buf, 2, FS_WRITE_FLUSH))) {
@@ -99,12 +109,10 @@ bool WritePatch() {
   totalRW += 2;
 
   // Write override table to code
-  for (const auto& override : overrides) {
-    if (!R_SUCCEEDED(res = FSFILE_Write(code, &bytesWritten, totalRW, &override, sizeof(override), FS_WRITE_FLUSH))) {
-      return false;
-    }
-    totalRW += sizeof(override);
+  if (!R_SUCCEEDED(res = FSFILE_Write(code, &bytesWritten, totalRW, ovrTable.get(), ovrTableSize, FS_WRITE_FLUSH))) {
+    return false;
   }
+  totalRW += ovrTableSize;
 
   /*-------------------------
   |     gSettingsContext    |
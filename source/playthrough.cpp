@@ -1,9 +1,12 @@
 #include "playthrough.hpp"
 
+#include "custom_messages.hpp"
 #include "fill.hpp"
 #include "location_access.hpp"
 #include "logic.hpp"
 #include "random.hpp"
+#include "seed_arena.hpp"
+#include "seed_stats.hpp"
 #include "spoiler_log.hpp"
 #include "../code/src/item_override.h"
 
@@ -15,21 +18,36 @@ namespace Playthrough {
     int Playthrough_Init(u32 seed) {
       Random_Init(seed);
 
-      overrides.clear();
+      //Drop everything left from the previous seed, then free its memory in one go
+      ClearSeedLocationData();
+      CustomMessages::ClearMessages();
+      PlacementLog_Clear();
+      SeedArena_Release();
+
       ItemReset();
       Exits::AccessReset();
 
       Settings::UpdateSettings();
+
+      //Stop before the fill if these settings can never produce a seed
+      if (!Settings::ValidateSettings()) {
+        return -2;
+      }
+      PlacementLog_Clear();
       Logic::UpdateHelpers();
 
       int ret = Fill();
+      if (SeedStats_IsCollecting()) {
+        SeedStats_AddSeed(ret);
+      }
       if (ret < 0) {
         return ret;
       }
 
       GenerateHash();
 
-      if (Settings::GenerateSpoilerLog) {
+      //bulk generation keeps statistics instead of a log for each seed
+      if (Settings::GenerateSpoilerLog && !SeedStats_IsCollecting()) {
         //write logs
         printf("\x1b[10;10HWriting Spoiler Log...");
         if (SpoilerLog_Write()) {
@@ -55,20 +73,35 @@ namespace Playthrough {
     //used for generating a lot of seeds at once
     int Playthrough_Repeat(int count /*= 1*/) {
       printf("\x1b[0;0HGENERATING %d SEEDS", count);
+      if (!SeedStats_Begin()) {
+        printf("\x1b[1;0HCouldn't open the statistics file");
+      }
+
+      //every seed starts from the settings chosen in the menu, even if generating one changed them
+      const std::string settingsString = Settings::GetSettingsString();
+
+      int ret = 1;
       u32 repeatedSeed = 0;
       for (int i = 0; i < count; i++) {
         repeatedSeed = rand() % 0xFFFFFFFF;
         Settings::seed = std::to_string(repeatedSeed);
-        Playthrough_Init(repeatedSeed);
+        Settings::SetSettingsString(settingsString);
+        //Hash the seed the same way the menu does, so any seed from the statistics can be entered
+        //with the settings string to reproduce it. If the settings are invalid, no other seed will work either.
+        if (Playthrough_Init(Settings::GetSeedHash(Settings::seed)) == -2) {
+          ret = -2;
+          break;
+        }
         PlacementLog_Clear();
         printf("\x1b[15;15HSeeds Generated: %d\n", i + 1);
       }
 
-      return 1;
+      SeedStats_End();
+      return ret;
     }
 
     //idk where else to put this so it goes here
     s16 GetRandomPrice() {
-      return 5 * Random(1, 20);
+      return 5 * RandomFromStream(RANDOMSTREAM_PRICES, 1, 20);
     }
 }
@@ -1,6 +1,7 @@
 #include "preset.hpp"
 
 #include <3ds.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <array>
@@ -8,6 +9,9 @@
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "category.hpp"
@@ -119,18 +123,39 @@ bool SavePreset(std::string_view presetName, OptionCategory category) {
   return true;
 }
 
+static PresetLoadReport presetLoadReport;
+
+const PresetLoadReport& GetPresetLoadReport() {
+  return presetLoadReport;
+}
+
 //Read the preset XML file
 bool LoadPreset(std::string_view presetName, OptionCategory category) {
   using namespace tinyxml2;
 
+  presetLoadReport = {};
+
   XMLDocument preset;
   XMLError e = preset.LoadFile(PresetPath(presetName, category).c_str());
   if (e != XML_SUCCESS) {
     return false;
   }
 
-  XMLNode* curNode = preset.FirstChild();
+  //Index every entry by setting name in one pass, so presets saved in a
+  //different order or by an older version don't need any rescanning.
+  //The text is owned by the document, so nothing needs to be copied.
+  std::unordered_map<std::string_view, std::string_view> presetValues;
+  for (XMLElement* entry = preset.FirstChildElement("setting"); entry != nullptr; entry = entry->NextSiblingElement("setting")) {
+    XMLElement* settingName = entry->FirstChildElement("settingName");
+    XMLElement* valueName = entry->FirstChildElement("valueName");
+    if (settingName == nullptr || valueName == nullptr || settingName->GetText() == nullptr || valueName->GetText() == nullptr) {
+      presetLoadReport.unknownSettings++;
+      continue;
+    }
+    presetValues[settingName->GetText()] = valueName->GetText();
+  }
 
+  std::unordered_set<std::string_view> knownNames;
   for (MenuItem* menu : Settings::mainMenu) {
     if (menu->mode != OPTION_SUB_MENU) {
       continue;
@@ -141,40 +166,26 @@ bool LoadPreset(std::string_view presetName, OptionCategory category) {
         continue;
       }
 
-      // Since presets are saved linearly, we can simply loop through the nodes as
-      // we loop through the settings to find most of the matching elements.
-      std::string settingToFind = std::string{setting->GetName()};
-      std::string curSettingName = curNode->FirstChildElement("settingName")->GetText();
-      std::string curSettingValue = curNode->FirstChildElement("valueName")->GetText();
-
-      if (curSettingName == settingToFind) {
-        setting->SetSelectedIndexByString(curSettingValue);
-        curNode = curNode->NextSibling();
-      } else {
-        // If the current setting and element don't match, then search
-        // linearly from the beginning. This will get us back on track if the
-        // next setting and element line up with each other*/
-        curNode = preset.FirstChild();
-        bool settingFound = false;
-        while (curNode != nullptr) {
-          curSettingName = curNode->FirstChildElement("settingName")->GetText();
-          curSettingValue = curNode->FirstChildElement("valueName")->GetText();
-
-          if (curSettingName == settingToFind) {
-            setting->SetSelectedIndexByString(curSettingValue);
-            curNode = curNode->NextSibling();
-            settingFound = true;
-            break;
-          }
-          curNode = curNode->NextSibling();
-        }
-        //reset to the beginning if the setting wasn't found
-        if (!settingFound) {
-          curNode = preset.FirstChild();
-        }
+      auto value = presetValues.find(setting->GetName());
+      if (value == presetValues.end()) {
+        continue;
+      }
+      knownNames.insert(value->first);
+      //The setting still exists but this value doesn't anymore
+      if (!setting->SetSelectedIndexByString(value->second)) {
+        presetLoadReport.unknownValues++;
       }
     }
   }
+  for (const auto& [name, value] : presetValues) {
+    if (knownNames.count(name) == 0) {
+      presetLoadReport.unknownSettings++;
+    }
+  }
+
+  if (category == OptionCategory::Setting) {
+    Settings::ResetExcludedLocationConflicts();
+  }
   return true;
 }
 
@@ -204,17 +215,66 @@ bool SaveSpecifiedPreset(std::string_view presetName, OptionCategory category) {
   return SavePreset(presetName, category);
 }
 
+/*The cached settings are also saved in a small binary file so they can be
+  loaded quickly at startup. It holds a header followed by the packed settings
+  string. If the settings have changed since it was written, the layout hash
+  won't match and the XML copy is loaded instead.*/
+struct CachedSettingsHeader {
+  u32 magic;
+  u32 layoutHash;
+  u32 length;
+};
+
+#define CACHED_SETTINGS_MAGIC 0x53433344 //"D3CS"
+
+static std::string CachedSettingsBinPath() {
+  return std::string(GetBasePath(OptionCategory::Setting)).append("CACHED_SETTINGS.bin");
+}
+
+static bool SaveCachedSettingsBin() {
+  const std::string settingsString = Settings::GetSettingsString();
+  const CachedSettingsHeader header = {CACHED_SETTINGS_MAGIC, Settings::GetSettingsLayoutHash(), static_cast<u32>(settingsString.size())};
+
+  std::ofstream file(CachedSettingsBinPath(), std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(settingsString.data(), settingsString.size());
+  return file.good();
+}
+
+static bool LoadCachedSettingsBin() {
+  std::ifstream file(CachedSettingsBinPath(), std::ios::binary);
+  CachedSettingsHeader header;
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      header.magic != CACHED_SETTINGS_MAGIC || header.layoutHash != Settings::GetSettingsLayoutHash()) {
+    return false;
+  }
+
+  //a matching layout always packs to the same length, so anything else is a bad file
+  if (header.length != Settings::GetSettingsString().size()) {
+    return false;
+  }
+
+  std::string settingsString(header.length, '\0');
+  if (!file.read(settingsString.data(), header.length)) {
+    return false;
+  }
+  return Settings::SetSettingsString(settingsString);
+}
+
 void SaveCachedSettings() {
   SavePreset("CACHED_SETTINGS", OptionCategory::Setting);
+  SaveCachedSettingsBin();
 }
 
 void LoadCachedSettings() {
+  if (LoadCachedSettingsBin()) {
+    return;
+  }
+
   //If cache file exists, load it
-  for (const auto& entry : fs::directory_iterator(GetBasePath(OptionCategory::Setting))) {
-    if(entry.path().stem().string() == "CACHED_SETTINGS") {
-      //File exists, open
-      LoadPreset("CACHED_SETTINGS", OptionCategory::Setting);
-    }
+  struct stat cacheInfo;
+  if (stat(PresetPath("CACHED_SETTINGS", OptionCategory::Setting).c_str(), &cacheInfo) == 0) {
+    LoadPreset("CACHED_SETTINGS", OptionCategory::Setting);
   }
 }
 
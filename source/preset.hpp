@@ -1,15 +1,23 @@
 #pragma once
 
+#include <3ds.h>
 #include <string>
 #include <vector>
 
 enum class OptionCategory;
 
+//Entries from the last preset loaded that couldn't be applied
+struct PresetLoadReport {
+  u16 unknownSettings = 0; //settings that no longer exist
+  u16 unknownValues = 0;   //settings whose saved value no longer exists
+};
+
 bool CreatePresetDirectories();
 std::vector<std::string> GetSettingsPresets();
 void LoadCachedSettings();
 bool SavePreset(std::string_view presetName, OptionCategory category);
 bool LoadPreset(std::string_view presetName, OptionCategory category);
+const PresetLoadReport& GetPresetLoadReport();
 bool DeletePreset(std::string_view presetName, OptionCategory category);
 bool SaveSpecifiedPreset(std::string_view presetName, OptionCategory category);
 void SaveCachedSettings();
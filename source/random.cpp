@@ -1,23 +1,51 @@
 #include "random.hpp"
 
+#include <array>
 #include <random>
 
 static bool init = false;
-static std::mt19937_64 generator;
+static uint32_t baseSeed = 0;
+static std::array<std::mt19937_64, RANDOMSTREAM_MAX> generators;
+static RandomStream activeStream = RANDOMSTREAM_SETTINGS;
 
-//Initialize with seed specified
+static void SeedStream(RandomStream stream, uint32_t substream) {
+    std::seed_seq seq{baseSeed, static_cast<uint32_t>(stream), substream};
+    generators[stream].seed(seq);
+}
+
+//Initialize with seed specified, Random() draws from the settings stream until another is selected
 void Random_Init(uint32_t seed) {
     init = true;
-    generator = std::mt19937_64{seed};
+    baseSeed = seed;
+    for (uint32_t stream = 0; stream < RANDOMSTREAM_MAX; stream++) {
+        SeedStream(static_cast<RandomStream>(stream), 0);
+    }
+    activeStream = RANDOMSTREAM_SETTINGS;
 }
 
-//Returns a random integer in range [min, max-1]
-uint32_t Random(int min, int max) {
+//Restart a stream from the master seed and make Random() draw from it. Something
+//that has to be redone can pass a new substream to get different but still
+//reproducible numbers.
+void Random_SelectStream(RandomStream stream, uint32_t substream /*= 0*/) {
+    if (!init) {
+        Random_Init(static_cast<uint32_t>(std::random_device{}()));
+    }
+    SeedStream(stream, substream);
+    activeStream = stream;
+}
+
+//Returns a random integer in range [min, max-1] from the given stream
+uint32_t RandomFromStream(RandomStream stream, int min, int max) {
     if (!init) {
         //No seed given, get a random number from device to seed
         const auto seed = static_cast<uint32_t>(std::random_device{}());
         Random_Init(seed);
     }
     std::uniform_int_distribution<uint32_t> distribution(min, max-1);
-    return distribution(generator);
+    return distribution(generators[stream]);
+}
+
+//Returns a random integer in range [min, max-1] from the selected stream
+uint32_t Random(int min, int max) {
+    return RandomFromStream(activeStream, min, max);
 }
@@ -6,8 +6,21 @@
 #include <utility>
 #include <vector>
 
+//Separate streams derived from the master seed. Changing how many numbers
+//one part of generation draws doesn't change what any other part gets.
+enum RandomStream : uint32_t {
+    RANDOMSTREAM_SETTINGS,
+    RANDOMSTREAM_ITEM_POOL,
+    RANDOMSTREAM_PRICES,
+    RANDOMSTREAM_HASH,
+    RANDOMSTREAM_FILL, //one stream per fill phase starts here
+    RANDOMSTREAM_MAX = RANDOMSTREAM_FILL + 8,
+};
+
 void Random_Init(uint32_t seed);
+void Random_SelectStream(RandomStream stream, uint32_t substream = 0);
 uint32_t Random(int min, int max);
+uint32_t RandomFromStream(RandomStream stream, int min, int max);
 
 //Get a random element from a vector or array
 template <typename T>
@@ -0,0 +1,22 @@
+#include "seed_arena.hpp"
+
+#include <3ds.h>
+
+//Enough for a typical seed, anything past this falls back to the regular heap
+#define SEED_ARENA_SIZE 0x20000
+
+static u8 seedArenaBuffer[SEED_ARENA_SIZE];
+
+//Constructed on first use so globals in other files can be built with it
+static std::pmr::monotonic_buffer_resource& SeedArena() {
+  static std::pmr::monotonic_buffer_resource seedArena{seedArenaBuffer, sizeof(seedArenaBuffer)};
+  return seedArena;
+}
+
+std::pmr::memory_resource* SeedArena_Resource() {
+  return &SeedArena();
+}
+
+void SeedArena_Release() {
+  SeedArena().release();
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <memory_resource>
+
+//Memory resource for data that only lives as long as one generated seed
+//(overrides, playthrough spheres, custom messages, placement log)
+std::pmr::memory_resource* SeedArena_Resource();
+
+//Frees everything allocated from the seed arena at once.
+//Every container using SeedArena_Resource() must be emptied before calling this.
+void SeedArena_Release();
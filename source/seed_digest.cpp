@@ -0,0 +1,221 @@
+#include "seed_digest.hpp"
+
+#include "custom_messages.hpp"
+#include "fnv1a.hpp"
+#include "item_location.hpp"
+#include "patch_symbols.hpp"
+#include "playthrough.hpp"
+#include "preset.hpp"
+#include "settings.hpp"
+#include "../code/src/message.h"
+
+#include <sys/stat.h>
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+//Each line is "seed,settings" or "seed,settings,overrides,context,messages" with
+//the settings string from a spoiler log and the digests in hex. Empty settings
+//use the cached settings. The corpus is built into the app from romfs/, the host
+//tests in tests/ point these paths into the source tree instead.
+#ifndef GOLDEN_CORPUS_PATH
+#define GOLDEN_CORPUS_PATH "romfs:/golden-corpus.csv"
+#endif
+#ifndef GOLDEN_RESULTS_PATH
+#define GOLDEN_RESULTS_PATH "/3ds/oot3dr-golden-results.csv"
+#endif
+#ifndef GOLDEN_REPORT_PATH
+#define GOLDEN_REPORT_PATH "/3ds/oot3dr-golden-report.csv"
+#endif
+//Override tables of the corpus seeds, shipped next to the corpus and used to say
+//which locations changed. Seeds recorded on the 3DS save theirs to the SD card.
+#ifndef GOLDEN_OVERRIDES_DIR
+#define GOLDEN_OVERRIDES_DIR "romfs:/golden-overrides/"
+#endif
+#ifndef GOLDEN_RECORDED_OVERRIDES_DIR
+#define GOLDEN_RECORDED_OVERRIDES_DIR "/3ds/oot3dr-golden/"
+#endif
+
+template <typename T>
+static std::string_view AsBytes(const T& value) {
+  return std::string_view(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+SeedDigest SeedDigest_Compute() {
+  SeedDigest digest;
+
+  digest.overrides = FNV_OFFSET_BASIS;
+  for (const ItemOverride& override : overrides) {
+    digest.overrides = Fnv1a(digest.overrides, AsBytes(override));
+  }
+
+  const SettingsContext ctx = Settings::FillContext();
+  digest.context = Fnv1a(FNV_OFFSET_BASIS, AsBytes(ctx));
+
+  //hash the entries field by field, the text offsets are pointers so the raw
+  //entries would hash differently on a host with 64-bit pointers. Offsets are
+  //hashed from the start of the message data, so the digest doesn't change with
+  //where a patch build links it.
+  const auto [entries, entriesSize] = CustomMessages::RawMessageEntryData();
+  const auto [data, dataSize] = CustomMessages::RawMessageData();
+  digest.messages = FNV_OFFSET_BASIS;
+  const MessageEntry* entry = reinterpret_cast<const MessageEntry*>(entries);
+  for (u32 i = 0; i < entriesSize / sizeof(MessageEntry); i++, entry++) {
+    digest.messages = Fnv1a(digest.messages, AsBytes(std::array<u32, 4>{entry->id, entry->unk_04, entry->unk_08, entry->unk_0C}));
+    for (const MessageLanguageInfo& info : entry->info) {
+      const u32 address = static_cast<u32>(reinterpret_cast<uintptr_t>(info.offset));
+      const u32 offset = (address == 0) ? 0 : address - RCUSTOMMESSAGES_ADDR;
+      digest.messages = Fnv1a(digest.messages, AsBytes(std::array<u32, 2>{offset, info.length}));
+    }
+  }
+  digest.messages = Fnv1a(digest.messages, std::string_view(data, dataSize));
+
+  return digest;
+}
+
+//Settings strings can hold '/', so files are named after a hash of them
+static std::string OverridesPath(std::string_view dir, std::string_view seed, std::string_view settings) {
+  char settingsHash[9];
+  snprintf(settingsHash, sizeof(settingsHash), "%08lX", static_cast<unsigned long>(Fnv1a(FNV_OFFSET_BASIS, settings)));
+  return std::string(dir).append(seed).append("-").append(settingsHash).append(".bin");
+}
+
+static void SaveOverrides(const std::string& path) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  for (const ItemOverride& override : overrides) {
+    file.write(reinterpret_cast<const char*>(&override), sizeof(override));
+  }
+}
+
+static std::string LocationName(ItemOverride_Key key) {
+  for (ItemLocation* loc : allLocations) {
+    if (loc->Key().all == key.all) {
+      return std::string(loc->GetName());
+    }
+  }
+  char unknown[32];
+  snprintf(unknown, sizeof(unknown), "scene %02X flag %02X", key.scene, key.flag);
+  return unknown;
+}
+
+//Write a line for every location whose override differs from the recorded one
+static void ReportOverrideMismatches(std::ofstream& report, std::string_view seed, std::string_view settings) {
+  std::ifstream file(OverridesPath(GOLDEN_OVERRIDES_DIR, seed, settings), std::ios::binary);
+  if (!file) {
+    report << seed << ',' << settings << ",no recorded overrides,,\n";
+    return;
+  }
+  std::vector<ItemOverride> golden;
+  ItemOverride override;
+  while (file.read(reinterpret_cast<char*>(&override), sizeof(override))) {
+    golden.push_back(override);
+  }
+
+  auto reportLocation = [&](ItemOverride_Key key, u32 expected, u32 actual) {
+    char values[24];
+    snprintf(values, sizeof(values), ",%08lX,%08lX\n", static_cast<unsigned long>(expected), static_cast<unsigned long>(actual));
+    report << seed << ',' << settings << ",\"" << LocationName(key) << '"' << values;
+  };
+
+  //both tables are sorted by key, so walk them together
+  auto expected = golden.begin();
+  auto actual = overrides.begin();
+  while (expected != golden.end() || actual != overrides.end()) {
+    if (actual == overrides.end() || (expected != golden.end() && expected->key.all < actual->key.all)) {
+      reportLocation(expected->key, expected->value.all, 0);
+      ++expected;
+    } else if (expected == golden.end() || actual->key.all < expected->key.all) {
+      reportLocation(actual->key, 0, actual->value.all);
+      ++actual;
+    } else {
+      if (expected->value.all != actual->value.all) {
+        reportLocation(actual->key, expected->value.all, actual->value.all);
+      }
+      ++expected;
+      ++actual;
+    }
+  }
+}
+
+static std::string DigestString(const SeedDigest& digest) {
+  char str[32];
+  snprintf(str, sizeof(str), "%08lX,%08lX,%08lX", static_cast<unsigned long>(digest.overrides),
+           static_cast<unsigned long>(digest.context), static_cast<unsigned long>(digest.messages));
+  return str;
+}
+
+int SeedDigest_CheckCorpus() {
+  romfsInit();
+  std::ifstream corpus(GOLDEN_CORPUS_PATH);
+  if (!corpus) {
+    printf("\x1b[10;1HNo corpus at " GOLDEN_CORPUS_PATH);
+    return 0;
+  }
+  mkdir(GOLDEN_RECORDED_OVERRIDES_DIR, 0777);
+
+  std::ofstream results(GOLDEN_RESULTS_PATH, std::ios::trunc);
+  std::ofstream report(GOLDEN_REPORT_PATH, std::ios::trunc);
+  results << "seed,settings,overrides,context,messages,result\n";
+  report << "seed,settings,location,expected,actual\n";
+
+  const std::string originalSeed = Settings::seed;
+  int checked = 0, mismatched = 0, recorded = 0;
+  printf("\x1b[0;0HCHECKING GOLDEN SEEDS");
+
+  std::string line;
+  while (std::getline(corpus, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::vector<std::string> fields;
+    std::stringstream lineStream(line);
+    for (std::string field; std::getline(lineStream, field, ',');) {
+      fields.push_back(field);
+    }
+    const std::string seed = fields[0];
+    const std::string settings = fields.size() > 1 ? fields[1] : "";
+
+    if (settings.empty()) {
+      LoadCachedSettings();
+    } else if (!Settings::SetSettingsString(settings)) {
+      results << seed << ',' << settings << ",,,,BAD SETTINGS\n";
+      mismatched++;
+      continue;
+    }
+
+    Settings::seed = seed;
+    const int ret = Playthrough::Playthrough_Init(Settings::GetSeedHash(seed));
+    const std::string digest = (ret < 0) ? ",," : DigestString(SeedDigest_Compute());
+
+    results << seed << ',' << settings << ',' << digest << ',';
+    if (ret < 0) {
+      results << "FAILED\n";
+      mismatched++;
+    } else if (fields.size() < 5) {
+      SaveOverrides(OverridesPath(GOLDEN_RECORDED_OVERRIDES_DIR, seed, settings));
+      results << "RECORDED\n";
+      recorded++;
+    } else if (digest == fields[2] + ',' + fields[3] + ',' + fields[4]) {
+      results << "MATCH\n";
+    } else {
+      results << "MISMATCH\n";
+      if (digest.substr(0, 8) != fields[2]) {
+        ReportOverrideMismatches(report, seed, settings);
+      }
+      mismatched++;
+    }
+    printf("\x1b[15;15HSeeds Checked: %d\n", ++checked);
+  }
+
+  //put back the settings and seed the check was started with
+  LoadCachedSettings();
+  Settings::seed = originalSeed;
+
+  printf("\x1b[16;15HMismatched: %d\n\x1b[17;15HRecorded: %d\n", mismatched, recorded);
+  return mismatched;
+}
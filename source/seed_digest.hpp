@@ -0,0 +1,18 @@
+#pragma once
+
+#include <3ds.h>
+
+//Hashes of everything a generated seed sends to the patch. Two builds that
+//make the same digests for a seed and settings generate the same world.
+struct SeedDigest {
+  u32 overrides = 0;
+  u32 context = 0;
+  u32 messages = 0;
+};
+
+SeedDigest SeedDigest_Compute();
+
+//Regenerates every seed and settings pair listed in the golden corpus and
+//compares the digests with the ones stored there. Entries without digests are
+//recorded instead. Returns the number of seeds that didn't match.
+int SeedDigest_CheckCorpus();
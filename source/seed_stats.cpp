@@ -0,0 +1,175 @@
+#include "seed_stats.hpp"
+
+#include "fill.hpp"
+#include "item_location.hpp"
+#include "settings.hpp"
+
+#include <3ds.h>
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#define SEED_STATS_PATH "/3ds/oot3dr-seedstats.csv"
+#define SEED_STATS_SUMMARY_PATH "/3ds/oot3dr-seedstats-summary.csv"
+
+static bool collecting = false;
+static std::ofstream seedsFile;
+
+static u32 seedCount = 0;
+static u32 totalFillAttempts = 0;
+static u32 totalPhaseRollbacks = 0;
+static u64 totalPhaseTicks[FILLPHASE_MAX] = {};
+static std::vector<u32> sphereCounts;   //seeds by number of playthrough spheres
+static std::vector<std::pair<std::string, int>> failedSeeds;
+
+//How often each item was placed at each location. Items are given a slot the
+//first time they're seen, so only items that actually show up take space.
+static std::unordered_map<u32, u16> itemSlots;
+static std::vector<std::string> itemNames;
+static std::vector<ItemLocation*> locationsById;
+static std::vector<std::vector<u32>> placementCounts; //[location id][item slot]
+
+static u32 ItemKey(const Item& item) {
+  return (static_cast<u32>(item.GetItemType()) << 16) | static_cast<u16>(item.GetItemID());
+}
+
+static void CountPlacement(ItemLocation* loc) {
+  const Item& item = loc->GetPlacedItem();
+  if (item == NoItem) {
+    return;
+  }
+
+  auto [slot, inserted] = itemSlots.try_emplace(ItemKey(item), static_cast<u16>(itemNames.size()));
+  if (inserted) {
+    itemNames.emplace_back(item.GetName());
+  }
+
+  std::vector<u32>& counts = placementCounts[loc->GetId()];
+  if (counts.size() <= slot->second) {
+    counts.resize(itemNames.size());
+  }
+  counts[slot->second]++;
+  locationsById[loc->GetId()] = loc;
+}
+
+static double TicksToMsec(u64 ticks) {
+  return ticks / CPU_TICKS_PER_MSEC;
+}
+
+bool SeedStats_Begin() {
+  seedCount = 0;
+  totalFillAttempts = 0;
+  totalPhaseRollbacks = 0;
+  std::fill(std::begin(totalPhaseTicks), std::end(totalPhaseTicks), 0);
+  sphereCounts.clear();
+  failedSeeds.clear();
+  itemSlots.clear();
+  itemNames.clear();
+  locationsById.assign(ItemLocation::Count(), nullptr);
+  placementCounts.assign(ItemLocation::Count(), {});
+
+  seedsFile.open(SEED_STATS_PATH, std::ios::trunc);
+  seedsFile << "seed,result,fill attempts,phase rollbacks,spheres";
+  for (const char* phaseName : fillPhaseNames) {
+    seedsFile << ',' << phaseName << " ms";
+  }
+  seedsFile << '\n';
+
+  collecting = seedsFile.good();
+  return collecting;
+}
+
+bool SeedStats_IsCollecting() {
+  return collecting;
+}
+
+//Called right after the fill of Settings::seed, while the playthrough is still available
+void SeedStats_AddSeed(int result) {
+  const FillRetryInfo& fillInfo = GetFillRetryInfo();
+  const size_t spheres = (result < 0) ? 0 : playthroughLocations.size();
+
+  seedCount++;
+  totalFillAttempts += fillInfo.fillAttempts;
+  totalPhaseRollbacks += fillInfo.phaseRollbacks;
+  for (size_t i = 0; i < FILLPHASE_MAX; i++) {
+    totalPhaseTicks[i] += fillInfo.phaseTicks[i];
+  }
+
+  if (result < 0) {
+    failedSeeds.emplace_back(Settings::seed, result);
+  } else {
+    if (sphereCounts.size() <= spheres) {
+      sphereCounts.resize(spheres + 1);
+    }
+    sphereCounts[spheres]++;
+
+    for (ItemLocation* loc : allLocations) {
+      CountPlacement(loc);
+    }
+    for (ItemLocation* loc : dungeonRewardLocations) {
+      CountPlacement(loc);
+    }
+  }
+
+  seedsFile << Settings::seed << ',' << result << ',' << fillInfo.fillAttempts << ',' << fillInfo.phaseRollbacks << ',' << spheres;
+  for (u64 ticks : fillInfo.phaseTicks) {
+    seedsFile << ',' << TicksToMsec(ticks);
+  }
+  seedsFile << '\n';
+}
+
+bool SeedStats_End() {
+  if (!collecting) {
+    return false;
+  }
+  collecting = false;
+  seedsFile.close();
+
+  const std::string settingsString = Settings::GetSettingsString();
+  std::ofstream summary(SEED_STATS_SUMMARY_PATH, std::ios::trunc);
+  summary << "version," << Settings::version << '\n';
+  summary << "settings," << settingsString << '\n';
+  summary << "seeds," << seedCount << '\n';
+  summary << "failed seeds," << failedSeeds.size() << '\n';
+  summary << "fill attempts," << totalFillAttempts << '\n';
+  summary << "phase rollbacks," << totalPhaseRollbacks << '\n';
+  if (seedCount > 0) {
+    summary << "fill retries per seed," << static_cast<double>(totalFillAttempts - seedCount) / seedCount << '\n';
+  }
+
+  summary << "\nphase,average ms\n";
+  for (size_t i = 0; i < FILLPHASE_MAX; i++) {
+    summary << fillPhaseNames[i] << ',' << (seedCount > 0 ? TicksToMsec(totalPhaseTicks[i]) / seedCount : 0.0) << '\n';
+  }
+
+  summary << "\nspheres,seeds\n";
+  for (size_t spheres = 0; spheres < sphereCounts.size(); spheres++) {
+    if (sphereCounts[spheres] > 0) {
+      summary << spheres << ',' << sphereCounts[spheres] << '\n';
+    }
+  }
+
+  //Playthrough_Repeat starts every seed from these settings, so the string above reproduces any of these
+  summary << "\nfailed seed,result,settings\n";
+  for (auto& [seed, result] : failedSeeds) {
+    summary << seed << ',' << result << ',' << settingsString << '\n';
+  }
+
+  summary << "\nlocation,item,count\n";
+  for (size_t id = 0; id < locationsById.size(); id++) {
+    if (locationsById[id] == nullptr) {
+      continue;
+    }
+    for (size_t slot = 0; slot < placementCounts[id].size(); slot++) {
+      if (placementCounts[id][slot] > 0) {
+        summary << '"' << locationsById[id]->GetName() << "\",\"" << itemNames[slot] << "\"," << placementCounts[id][slot] << '\n';
+      }
+    }
+  }
+
+  itemSlots.clear();
+  placementCounts.clear();
+  return summary.good();
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <3ds.h>
+
+//Statistics over many seeds generated with the same settings, used by
+//Playthrough_Repeat. One line per seed is written as it finishes, and the
+//totals are written once at the end. No spoiler text is kept for any seed.
+bool SeedStats_Begin();
+bool SeedStats_IsCollecting();
+void SeedStats_AddSeed(int result);
+bool SeedStats_End();
@@ -4,11 +4,15 @@
 
 #include "cosmetics.hpp"
 #include "dungeon.hpp"
+#include "exclusion_rules.hpp"
 #include "fill.hpp"
+#include "fnv1a.hpp"
 #include "item_location.hpp"
+#include "item_pool.hpp"
 #include "random.hpp"
 #include "randomizer.hpp"
 #include "setting_descriptions.hpp"
+#include "starting_inventory.hpp"
 
 using namespace Cosmetics;
 using namespace Dungeon;
@@ -34,6 +38,7 @@ namespace Settings {
   Option BridgeTokenCount    = Option::U8  ("  Token Count",          {/*Options 0-100 defined in SetDefaultSettings()*/},                          {bridgeTokenCountDesc});
   Option RandomGanonsTrials  = Option::Bool("Random Ganon's Trials",  {"Off", "On"},                                                                {randomGanonsTrialsDesc});
   Option GanonsTrialsCount   = Option::U8  ("  Trial Count",          {"0", "1", "2", "3", "4", "5", "6"},                                          {ganonsTrialCountDesc});
+  u8 ResolvedGanonsTrialsCount;
   std::vector<Option *> openOptions = {
     &Logic,
     &OpenForest,
@@ -58,6 +63,7 @@ namespace Settings {
   Option BombchuDrops        = Option::Bool("Bombchu Drops",          {"Off", "On"},                                                     {bombchuDropDesc});
   Option RandomMQDungeons    = Option::Bool("Random MQ Dungeons",     {"Off", "On"},                                                     {randomMQDungeonsDesc});
   Option MQDungeonCount      = Option::U8  ("  MQ Dungeon Count",     {"0","1","2","3","4","5","6","7","8","9","10","11","12"},          {mqDungeonCountDesc});
+  u8 ResolvedMQDungeonCount;
   std::vector<Option *> worldOptions = {
     &StartingAge,
     &BombchusInLogic,
@@ -415,6 +421,142 @@ namespace Settings {
   //declared here, set in menu.cpp
   u8 PlayOption;
 
+  //Calls func on every option that affects generation, always in the same order
+  template <typename Func>
+  static void ForEachSetting(Func func) {
+    for (MenuItem* menu : mainMenu) {
+      //don't go through non-menus
+      if (menu->mode != OPTION_SUB_MENU) {
+        continue;
+      }
+
+      for (Option* setting : *menu->settingsList) {
+        if (setting->IsCategory(OptionCategory::Setting)) {
+          func(setting);
+        }
+      }
+    }
+  }
+
+  //Number of bits needed to store any selected index of this option
+  static u8 OptionBitWidth(const Option* option) {
+    u8 bits = 0;
+    while ((1U << bits) < option->GetOptionCount()) {
+      bits++;
+    }
+    return bits;
+  }
+
+  //Packs the selected index of every setting into as few bits as possible
+  static std::vector<u8> PackSettings() {
+    std::vector<u8> packed;
+    u32 bitPos = 0;
+    ForEachSetting([&](Option* setting) {
+      const u8 index = setting->GetSelectedOptionIndex();
+      for (u8 bit = 0; bit < OptionBitWidth(setting); bit++, bitPos++) {
+        if (bitPos % 8 == 0) {
+          packed.push_back(0);
+        }
+        packed.back() |= ((index >> bit) & 1) << (bitPos % 8);
+      }
+    });
+    return packed;
+  }
+
+  static constexpr std::string_view base64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  //Short string that can be shared to reproduce the current settings
+  std::string GetSettingsString() {
+    const std::vector<u8> packed = PackSettings();
+    std::string settingsString;
+    u32 buffer = 0;
+    u8 bufferedBits = 0;
+    for (u8 byte : packed) {
+      buffer = (buffer << 8) | byte;
+      bufferedBits += 8;
+      while (bufferedBits >= 6) {
+        bufferedBits -= 6;
+        settingsString += base64Chars[(buffer >> bufferedBits) & 0x3F];
+      }
+    }
+    if (bufferedBits > 0) {
+      settingsString += base64Chars[(buffer << (6 - bufferedBits)) & 0x3F];
+    }
+    return settingsString;
+  }
+
+  //Applies a string made by GetSettingsString. Nothing is changed if the
+  //string is invalid or was made with a different set of settings.
+  bool SetSettingsString(std::string_view settingsString) {
+    std::vector<u8> packed;
+    u32 buffer = 0;
+    u8 bufferedBits = 0;
+    for (char c : settingsString) {
+      const size_t value = base64Chars.find(c);
+      if (value == std::string_view::npos) {
+        return false;
+      }
+      buffer = (buffer << 6) | value;
+      bufferedBits += 6;
+      if (bufferedBits >= 8) {
+        bufferedBits -= 8;
+        packed.push_back((buffer >> bufferedBits) & 0xFF);
+      }
+    }
+
+    //read every index first so a bad string doesn't leave settings half applied
+    std::vector<u8> indices;
+    u32 bitPos = 0;
+    bool valid = true;
+    ForEachSetting([&](Option* setting) {
+      u8 index = 0;
+      for (u8 bit = 0; bit < OptionBitWidth(setting); bit++, bitPos++) {
+        if (bitPos / 8 >= packed.size()) {
+          valid = false;
+          return;
+        }
+        index |= ((packed[bitPos / 8] >> (bitPos % 8)) & 1) << bit;
+      }
+      valid = valid && index < setting->GetOptionCount();
+      indices.push_back(index);
+    });
+    if (!valid || (bitPos + 7) / 8 != packed.size()) {
+      return false;
+    }
+
+    size_t i = 0;
+    ForEachSetting([&](Option* setting) {
+      setting->SetSelectedIndex(indices[i++]);
+    });
+    ResetExcludedLocationConflicts();
+    return true;
+  }
+
+  //Hash of the seed and packed settings, used to seed the randomizer
+  u32 GetSeedHash(std::string_view seedStr) {
+    return Fnv1a(Fnv1a(FNV_OFFSET_BASIS, seedStr), PackSettings());
+  }
+
+  //Bump when an index starts meaning something else without any setting
+  //name or option text changing
+  constexpr u8 SETTINGS_LAYOUT_VERSION = 1;
+
+  //Hash of every setting's name and option texts, which changes whenever
+  //a packed settings string from another version would be read differently
+  u32 GetSettingsLayoutHash() {
+    u32 hash = Fnv1a(FNV_OFFSET_BASIS, std::array<u8, 1>{SETTINGS_LAYOUT_VERSION});
+    ForEachSetting([&hash](Option* setting) {
+      hash = Fnv1a(hash, setting->GetName());
+      hash = Fnv1a(hash, std::array<u8, 1>{static_cast<u8>(setting->GetOptionCount())});
+      for (size_t i = 0; i < setting->GetOptionCount(); i++) {
+        hash = Fnv1a(hash, setting->GetOptionText(i));
+        //keep "ab","c" and "a","bc" apart
+        hash = Fnv1a(hash, std::array<u8, 1>{0});
+      }
+    });
+    return hash;
+  }
+
   //Fills a SettingsContext struct which is sent to the patch
   SettingsContext FillContext() {
     SettingsContext ctx = {};
@@ -437,7 +579,7 @@ namespace Settings {
     ctx.bridgeDungeonCount   = BridgeDungeonCount.Value<u8>();
     ctx.bridgeTokenCount     = BridgeTokenCount.Value<u8>();
     ctx.randomGanonsTrials   = (RandomGanonsTrials) ? 1 : 0;
-    ctx.ganonsTrialsCount    = GanonsTrialsCount.Value<u8>();
+    ctx.ganonsTrialsCount    = ResolvedGanonsTrialsCount;
 
     ctx.startingAge          = StartingAge.Value<u8>();
     ctx.resolvedStartingAge  = ResolvedStartingAge;
@@ -445,7 +587,7 @@ namespace Settings {
     ctx.bombchusInLogic      = (BombchusInLogic) ? 1 : 0;
     ctx.bombchuDrops         = (BombchuDrops) ? 1 : 0;
     ctx.randomMQDungeons     = (RandomMQDungeons) ? 1 : 0;
-    ctx.mqDungeonCount       = MQDungeonCount.Value<u8>();
+    ctx.mqDungeonCount       = ResolvedMQDungeonCount;
     ctx.mirrorWorld          = (MirrorWorld) ? 1 : 0;
 
     ctx.shuffleRewards       = ShuffleRewards.Value<u8>();
@@ -574,163 +716,60 @@ namespace Settings {
     SetDefaultCosmetics();
   }
 
-  //Include and Lock the desired locations
-  void IncludeAndHide(std::vector<ItemLocation*> locations) {
-    for (auto& loc : locations) {
-      loc->GetExcludedOption()->SetSelectedIndex(INCLUDE);
-      loc->GetExcludedOption()->Hide();
-    }
+  static std::vector<ItemLocation*> DungeonSkulltulas() {
+    std::vector<ItemLocation*> skulltulaLocations = GetLocations(everyPossibleLocation, Category::cSkulltula);
+    return FilterFromPool(skulltulaLocations, [](ItemLocation* loc){ return loc->GetScene() < 0x0A;});
   }
 
-  //Unlock the desired locations
-  void Unhide(std::vector<ItemLocation*> locations) {
-    for (auto& loc : locations) {
-      loc->GetExcludedOption()->Unhide();
-    }
+  static std::vector<ItemLocation*> OverworldSkulltulas() {
+    std::vector<ItemLocation*> skulltulaLocations = GetLocations(everyPossibleLocation, Category::cSkulltula);
+    return FilterFromPool(skulltulaLocations, [](ItemLocation* loc){ return loc->GetScene() >= 0x0A;});
   }
 
-  //Lock required locations based on current settings
-  void ResolveExcludedLocationConflicts() {
-
-    //Force include shops if shopsanity is off
-    std::vector<ItemLocation*> shopLocations = GetLocations(everyPossibleLocation, Category::cShop);
-    // if (Shopsanity.IsNot(SHOPSANITY_OFF)) {
-    //   Unhide(shopLocations);
-    // } else {
-    //   IncludeAndHide(shopLocations);
-    // }
+  //Locations that must stay included for the current settings, see exclusion_rules.hpp
+  static ExclusionRules<Option, ItemLocation> exclusionRules({
     //For now, just always hide shop locations, as not sure how to handle hiding them-
     //1-4 should always be hidden, while the others should be settings dependent, but random shopsanity makes that more complicated...
-    IncludeAndHide(shopLocations);
-
+    {{}, []{ return true; }, []{ return GetLocations(everyPossibleLocation, Category::cShop); }},
     //Force include song locations
-    std::vector<ItemLocation*> songLocations = GetLocations(everyPossibleLocation, Category::cSong);
-    std::vector<ItemLocation*> songDungeonRewards = GetLocations(everyPossibleLocation, Category::cSongDungeonReward);
-
-    //Unhide all song locations, then lock necessary ones
-    Unhide(songLocations);
-    Unhide(songDungeonRewards);
-
-    if (ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS)) {
-      IncludeAndHide(songLocations);
-    } else if (ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS)) {
-      IncludeAndHide(songDungeonRewards);
-    }
-
+    {{&ShuffleSongs}, []{ return ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS); }, []{ return GetLocations(everyPossibleLocation, Category::cSong); }},
+    {{&ShuffleSongs}, []{ return ShuffleSongs.Is(SONGSHUFFLE_DUNGEON_REWARDS); }, []{ return GetLocations(everyPossibleLocation, Category::cSongDungeonReward); }},
     //Force Include Vanilla Skulltula locations
-    std::vector<ItemLocation*> skulltulaLocations = GetLocations(everyPossibleLocation, Category::cSkulltula);
-    Unhide(skulltulaLocations);
-    if (Tokensanity.IsNot(TOKENSANITY_ALL_TOKENS)) {
-      if (Tokensanity.Is(TOKENSANITY_OVERWORLD)) {
-        //filter overworld skulls so we're just left with dungeons
-        FilterAndEraseFromPool(skulltulaLocations, [](ItemLocation* loc){return loc->GetScene() >= 0x0A;});
-      } else if (Tokensanity.Is(TOKENSANITY_DUNGEONS)) {
-        //filter dungeon skulls so we're just left with overworld
-        FilterAndEraseFromPool(skulltulaLocations, [](ItemLocation* loc){return loc->GetScene() < 0x0A;});
-      }
-      IncludeAndHide(skulltulaLocations);
-    }
-
+    {{&Tokensanity}, []{ return Tokensanity.IsNot(TOKENSANITY_ALL_TOKENS) && Tokensanity.IsNot(TOKENSANITY_DUNGEONS); }, DungeonSkulltulas},
+    {{&Tokensanity}, []{ return Tokensanity.IsNot(TOKENSANITY_ALL_TOKENS) && Tokensanity.IsNot(TOKENSANITY_OVERWORLD); }, OverworldSkulltulas},
     //Force Include scrubs if Scrubsanity is Off
-    std::vector<ItemLocation*> scrubLocations = GetLocations(everyPossibleLocation, Category::cDekuScrub);
-    if (Scrubsanity.Is(OFF)) {
-      IncludeAndHide(scrubLocations);
-    } else {
-      Unhide(scrubLocations);
-    }
-
+    {{&Scrubsanity}, []{ return Scrubsanity.Is(OFF); }, []{ return GetLocations(everyPossibleLocation, Category::cDekuScrub); }},
     //Force include Cows if Shuffle Cows is Off
-    std::vector<ItemLocation*> cowLocations = GetLocations(everyPossibleLocation, Category::cCow);
-    if (ShuffleCows) {
-      Unhide(cowLocations);
-    } else {
-      IncludeAndHide(cowLocations);
-    }
-
+    {{&ShuffleCows}, []{ return !ShuffleCows; }, []{ return GetLocations(everyPossibleLocation, Category::cCow); }},
     //Force include the Kokiri Sword Chest if Shuffle Kokiri Sword is Off
-    if (ShuffleKokiriSword) {
-      Unhide({&KF_KokiriSwordChest});
-    } else {
-      IncludeAndHide({&KF_KokiriSwordChest});
-    }
-
+    {{&ShuffleKokiriSword}, []{ return !ShuffleKokiriSword; }, []{ return std::vector<ItemLocation*>{&KF_KokiriSwordChest}; }},
     //Force include the ocarina locations if Shuffle Ocarinas is Off
-    std::vector<ItemLocation*> ocarinaLocations = {&LW_GiftFromSaria, &HF_OcarinaOfTimeItem};
-    if (ShuffleOcarinas) {
-      Unhide(ocarinaLocations);
-    } else {
-      IncludeAndHide(ocarinaLocations);
-    }
-
+    {{&ShuffleOcarinas}, []{ return !ShuffleOcarinas; }, []{ return std::vector<ItemLocation*>{&LW_GiftFromSaria, &HF_OcarinaOfTimeItem}; }},
     //Force include Malon if Shuffle Weird Egg is Off
-    if (ShuffleWeirdEgg) {
-      Unhide({&HC_MalonEgg});
-    } else {
-      IncludeAndHide({&HC_MalonEgg});
-    }
-
+    {{&ShuffleWeirdEgg}, []{ return !ShuffleWeirdEgg; }, []{ return std::vector<ItemLocation*>{&HC_MalonEgg}; }},
     //Force include Gerudo Token Location if it's not shuffled
-    if (ShuffleGerudoToken) {
-      Unhide({&GF_GerudoToken});
-    } else {
-      IncludeAndHide({&GF_GerudoToken});
-    }
-
+    {{&ShuffleGerudoToken}, []{ return !ShuffleGerudoToken; }, []{ return std::vector<ItemLocation*>{&GF_GerudoToken}; }},
     //Force include Magic Bean salesman if Shuffle Magic Beans is off
-    if (ShuffleMagicBeans) {
-      Unhide({&ZR_MagicBeanSalesman});
-    } else {
-      IncludeAndHide({&ZR_MagicBeanSalesman});
-    }
-
+    {{&ShuffleMagicBeans}, []{ return !ShuffleMagicBeans; }, []{ return std::vector<ItemLocation*>{&ZR_MagicBeanSalesman}; }},
     //Force include Map and Compass Chests when Vanilla
-    std::vector<ItemLocation*> mapChests = GetLocations(everyPossibleLocation, Category::cVanillaMap);
-    std::vector<ItemLocation*> compassChests = GetLocations(everyPossibleLocation, Category::cVanillaCompass);
-    if (MapsAndCompasses.Is(MAPSANDCOMPASSES_VANILLA)) {
-      IncludeAndHide(mapChests);
-      IncludeAndHide(compassChests);
-    } else {
-      Unhide(mapChests);
-      Unhide(compassChests);
-    }
-
+    {{&MapsAndCompasses}, []{ return MapsAndCompasses.Is(MAPSANDCOMPASSES_VANILLA); }, []{ return GetLocations(everyPossibleLocation, Category::cVanillaMap); }},
+    {{&MapsAndCompasses}, []{ return MapsAndCompasses.Is(MAPSANDCOMPASSES_VANILLA); }, []{ return GetLocations(everyPossibleLocation, Category::cVanillaCompass); }},
     //Force include Vanilla Small Key Locations (except gerudo Fortress) on Vanilla Keys
-    std::vector<ItemLocation*> smallKeyChests = GetLocations(everyPossibleLocation, Category::cVanillaSmallKey);
-    if (Keysanity.Is(KEYSANITY_VANILLA)) {
-      IncludeAndHide(smallKeyChests);
-    } else {
-      Unhide(smallKeyChests);
-    }
-
+    {{&Keysanity}, []{ return Keysanity.Is(KEYSANITY_VANILLA); }, []{ return GetLocations(everyPossibleLocation, Category::cVanillaSmallKey); }},
     //Force include Gerudo Fortress carpenter fights if GF Small Keys are Vanilla
-    std::vector<ItemLocation*> vanillaGFKeyLocations = GetLocations(everyPossibleLocation, Category::cVanillaGFSmallKey);
-    if (GerudoKeys.Is(GERUDOKEYS_VANILLA)) {
-      IncludeAndHide(vanillaGFKeyLocations);
-    } else {
-      Unhide(vanillaGFKeyLocations);
-    }
-
+    {{&GerudoKeys}, []{ return GerudoKeys.Is(GERUDOKEYS_VANILLA); }, []{ return GetLocations(everyPossibleLocation, Category::cVanillaGFSmallKey); }},
     //Force include Boss Key Chests if Boss Keys are Vanilla
-    std::vector<ItemLocation*> bossKeyChests = GetLocations(everyPossibleLocation, Category::cVanillaBossKey);
-    if (BossKeysanity.Is(BOSSKEYSANITY_VANILLA)) {
-      IncludeAndHide(bossKeyChests);
-    } else {
-      Unhide(bossKeyChests);
-    }
-
+    {{&BossKeysanity}, []{ return BossKeysanity.Is(BOSSKEYSANITY_VANILLA); }, []{ return GetLocations(everyPossibleLocation, Category::cVanillaBossKey); }},
     //Force include Ganons Boss Key Chest if ganons boss key has to be there
-    if (GanonsBossKey.Is(GANONSBOSSKEY_VANILLA)) {
-      IncludeAndHide({&GanonsCastle_BossKeyChest});
-    } else {
-      Unhide({&GanonsCastle_BossKeyChest});
-    }
-
+    {{&GanonsBossKey}, []{ return GanonsBossKey.Is(GANONSBOSSKEY_VANILLA); }, []{ return std::vector<ItemLocation*>{&GanonsCastle_BossKeyChest}; }},
     //Force include Light Arrow item if ganons boss key has to be there
-    if (GanonsBossKey.Value<u8>() >= GANONSBOSSKEY_LACS_VANILLA) {
-      IncludeAndHide({&ToT_LightArrowCutscene});
-    } else {
-      Unhide({&ToT_LightArrowCutscene});
-    }
+    {{&GanonsBossKey}, []{ return GanonsBossKey.Value<u8>() >= GANONSBOSSKEY_LACS_VANILLA; }, []{ return std::vector<ItemLocation*>{&ToT_LightArrowCutscene}; }},
+  }, LOCATIONS_MAX, INCLUDE);
+
+  //Recheck every rule the next time conflicts are resolved, used after the
+  //exclude options were changed without going through the menu
+  void ResetExcludedLocationConflicts() {
+    exclusionRules.MarkStale();
   }
 
   //Make any forcible setting changes when certain settings change
@@ -863,7 +902,8 @@ namespace Settings {
       }
     }
 
-    ResolveExcludedLocationConflicts();
+    //Lock required locations based on current settings
+    exclusionRules.Resolve();
   }
 
   //eventual settings
@@ -905,6 +945,7 @@ namespace Settings {
 
   //Function to set flags depending on settings
   void UpdateSettings() {
+    Random_SelectStream(RANDOMSTREAM_SETTINGS);
 
     //shuffle the dungeons and then set MQ for as many as necessary
     auto dungeons = dungeonList;
@@ -915,22 +956,31 @@ namespace Settings {
       dungeons[i]->ClearMQ();
     }
 
-    //Set appropriate amount of MQ dungeons
+    //Set appropriate amount of MQ dungeons, a random count is kept apart from the
+    //option so the settings chosen in the menu stay the same from seed to seed
     if (RandomMQDungeons) {
-      MQDungeonCount.SetSelectedIndex(Random(0, MQDungeonCount.GetOptionCount()));
+      ResolvedMQDungeonCount = Random(0, MQDungeonCount.GetOptionCount());
+    } else {
+      ResolvedMQDungeonCount = MQDungeonCount.Value<u8>();
     }
-    for (u8 i = 0; i < MQDungeonCount.Value<u8>(); i++) {
+    for (u8 i = 0; i < ResolvedMQDungeonCount; i++) {
       dungeons[i]->SetMQ();
     }
 
-    //shuffle the trials then require the amount set in GanonsTrialsCount
+    //shuffle the trials then require the resolved amount
     std::array<bool*, 6> trialsSkipped = {&ForestTrialSkip, &FireTrialSkip, &WaterTrialSkip, &SpiritTrialSkip, &ShadowTrialSkip, &LightTrialSkip};
+    //skip them all again, the previous seed may have required some
+    for (bool* trialSkipped : trialsSkipped) {
+      *trialSkipped = true;
+    }
     Shuffle(trialsSkipped);
 
     if (RandomGanonsTrials) {
-      GanonsTrialsCount.SetSelectedIndex(Random(0, GanonsTrialsCount.GetOptionCount()));
+      ResolvedGanonsTrialsCount = Random(0, GanonsTrialsCount.GetOptionCount());
+    } else {
+      ResolvedGanonsTrialsCount = GanonsTrialsCount.Value<u8>();
     }
-    for (u8 i = 0; i < GanonsTrialsCount.Value<u8>(); i++) {
+    for (u8 i = 0; i < ResolvedGanonsTrialsCount; i++) {
       *trialsSkipped[i] = false; //the selected trial is not skipped
     }
 
@@ -966,4 +1016,165 @@ namespace Settings {
     UpdateCosmetics();
   }
 
+  //Locations that can still take an item from the pool
+  static bool IsOpenLocation(ItemLocation* loc) {
+    return !loc->IsExcluded() && loc->GetPlacedItem() == NoItem;
+  }
+
+  static int CountOpenLocations(const std::vector<ItemLocation*>& locations) {
+    return std::count_if(locations.begin(), locations.end(), IsOpenLocation);
+  }
+
+  static int CountPoolItems(ItemType type) {
+    return std::count_if(ItemPool.begin(), ItemPool.end(), [type](const Item& i){ return i.GetItemType() == type;});
+  }
+
+  //Copies of these items anywhere in the world, including vanilla placements and starting items
+  static int CountItemsInWorld(const std::vector<Item>& items) {
+    auto matches = [&items](const Item& item){ return std::find(items.begin(), items.end(), item) != items.end();};
+    int count = std::count_if(ItemPool.begin(), ItemPool.end(), matches);
+    count += std::count_if(StartingInventory.begin(), StartingInventory.end(), matches);
+    count += std::count_if(allLocations.begin(), allLocations.end(), [&matches](ItemLocation* loc){ return matches(loc->GetPlacedItem());});
+    return count;
+  }
+
+  static std::string CountMismatch(int needed, std::string_view neededName, int available, std::string_view availableName) {
+    return std::to_string(needed) + " " + std::string(neededName) + ", " + std::to_string(available) + " " + std::string(availableName);
+  }
+
+  //Excluded locations only get junk, so every advancement item needs a location that isn't excluded
+  static std::string CheckItemCount() {
+    int advancementItems = std::count_if(ItemPool.begin(), ItemPool.end(), [](const Item& i){
+      //end of dungeon rewards go to the boss locations instead
+      return i.IsAdvancement() && !(i.GetItemType() == ITEMTYPE_DUNGEONREWARD && ShuffleRewards.Is(REWARDSHUFFLE_END_OF_DUNGEON));
+    });
+    int openLocations = CountOpenLocations(allLocations);
+    if (advancementItems > openLocations) {
+      return CountMismatch(advancementItems, "items", openLocations, "open locations");
+    }
+    return "";
+  }
+
+  static std::string CheckSongs() {
+    if (ShuffleSongs.Is(SONGSHUFFLE_ANYWHERE)) {
+      return "";
+    }
+
+    Category songCategory = ShuffleSongs.Is(SONGSHUFFLE_SONG_LOCATIONS) ? Category::cSong : Category::cSongDungeonReward;
+    int songs = CountPoolItems(ITEMTYPE_SONG);
+    int openLocations = CountOpenLocations(FilterFromPool(allLocations, [songCategory](ItemLocation* loc){ return loc->IsCategory(songCategory);}));
+    if (songs > openLocations) {
+      return CountMismatch(songs, "songs", openLocations, "open locations");
+    }
+    return "";
+  }
+
+  static std::string CheckDungeonRewards() {
+    int openLocations = 0;
+    if (ShuffleRewards.Is(REWARDSHUFFLE_ANY_DUNGEON)) {
+      for (auto dungeon : Dungeon::dungeonList) {
+        openLocations += CountOpenLocations(dungeon->GetDungeonLocations());
+      }
+    } else if (ShuffleRewards.Is(REWARDSHUFFLE_OVERWORLD)) {
+      openLocations = CountOpenLocations(overworldLocations);
+    } else {
+      return "";
+    }
+
+    int rewards = CountPoolItems(ITEMTYPE_DUNGEONREWARD);
+    if (rewards > openLocations) {
+      return CountMismatch(rewards, "rewards", openLocations, "open locations");
+    }
+    return "";
+  }
+
+  //How many of what the bridge or LACS condition asks for, and how many exist
+  struct ConditionCount {
+    int needed = 0;
+    std::string_view name = "";
+    int available = 0;
+  };
+
+  static ConditionCount GetBridgeCount() {
+    switch (Bridge.Value<u8>()) {
+      case RAINBOWBRIDGE_STONES:
+        return {BridgeStoneCount.Value<u8>(), "stones", CountItemsInWorld({I_KokiriEmerald, I_GoronRuby, I_ZoraSaphhire})};
+      case RAINBOWBRIDGE_MEDALLIONS:
+        return {BridgeMedallionCount.Value<u8>(), "medallions", CountItemsInWorld({I_ForestMedallion, I_FireMedallion, I_WaterMedallion, I_SpiritMedallion, I_ShadowMedallion, I_LightMedallion})};
+      case RAINBOWBRIDGE_REWARDS:
+        return {BridgeRewardCount.Value<u8>(), "rewards", static_cast<int>(dungeonRewardLocations.size())};
+      case RAINBOWBRIDGE_DUNGEONS:
+        //every reward location except Link's Pocket is a dungeon boss
+        return {BridgeDungeonCount.Value<u8>(), "dungeons", static_cast<int>(dungeonRewardLocations.size()) - 1};
+      case RAINBOWBRIDGE_TOKENS:
+        return {BridgeTokenCount.Value<u8>(), "tokens", CountItemsInWorld({GoldSkulltulaToken})};
+    }
+    return {};
+  }
+
+  static ConditionCount GetLACSCount() {
+    switch (LACSCondition) {
+      case LACSCONDITION_STONES:
+        return {LACSStoneCount.Value<u8>(), "stones", CountItemsInWorld({I_KokiriEmerald, I_GoronRuby, I_ZoraSaphhire})};
+      case LACSCONDITION_MEDALLIONS:
+        return {LACSMedallionCount.Value<u8>(), "medallions", CountItemsInWorld({I_ForestMedallion, I_FireMedallion, I_WaterMedallion, I_SpiritMedallion, I_ShadowMedallion, I_LightMedallion})};
+      case LACSCONDITION_REWARDS:
+        return {LACSRewardCount.Value<u8>(), "rewards", static_cast<int>(dungeonRewardLocations.size())};
+      case LACSCONDITION_DUNGEONS:
+        return {LACSDungeonCount.Value<u8>(), "dungeons", static_cast<int>(dungeonRewardLocations.size()) - 1};
+      case LACSCONDITION_TOKENS:
+        return {LACSTokenCount.Value<u8>(), "tokens", CountItemsInWorld({GoldSkulltulaToken})};
+    }
+    return {};
+  }
+
+  static std::string CheckConditionCount(ConditionCount (*getCount)()) {
+    ConditionCount count = getCount();
+    if (count.needed > count.available) {
+      return "needs " + CountMismatch(count.needed, count.name, count.available, "exist");
+    }
+    return "";
+  }
+
+  struct SettingsConstraint {
+    std::string_view name;
+    std::string (*check)();
+  };
+
+  //Each check returns what's wrong, or an empty string if the settings pass
+  static const std::array<SettingsConstraint, 5> settingsConstraints = {{
+    {"Items",           CheckItemCount},
+    {"Songs",           CheckSongs},
+    {"Dungeon Rewards", CheckDungeonRewards},
+    {"Bridge",          []{ return CheckConditionCount(GetBridgeCount); }},
+    {"Light Arrows",    []{ return CheckConditionCount(GetLACSCount); }},
+  }};
+
+  //Check the current settings against the pools they produce, before any
+  //time is spent on the fill. Prints each problem found and returns false if
+  //no seed could ever be generated with these settings.
+  bool ValidateSettings() {
+    //the same pools the first fill attempt will get
+    GenerateLocationAndItemPools(1);
+
+    bool valid = true;
+    int row = 9;
+    for (const SettingsConstraint& constraint : settingsConstraints) {
+      std::string problem = constraint.check();
+      if (problem.empty()) {
+        continue;
+      }
+      if (valid) {
+        printf("\x1b[%d;1HThese settings can't make a seed:", row++);
+        valid = false;
+      }
+      printf("\x1b[%d;2H%.*s: %s", row++, static_cast<int>(constraint.name.size()), constraint.name.data(), problem.c_str());
+    }
+
+    //The fill builds its own pools
+    ItemPool.clear();
+    ItemReset();
+    return valid;
+  }
+
 } // namespace Settings
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -59,12 +60,17 @@ public:
 
     void SetOptions(std::vector<std::string> o) {
         options = std::move(o);
+        sortedOptionIndices.clear();
     }
 
     size_t GetOptionCount() const {
         return options.size();
     }
 
+    std::string_view GetOptionText(size_t idx) const {
+        return options[idx];
+    }
+
     std::string_view GetName() const {
         return name;
     }
@@ -75,6 +81,7 @@ public:
 
     void SetSelectedOptionText(std::string newText) {
         options[selectedOption] = std::move(newText);
+        sortedOptionIndices.clear();
     }
 
     std::string_view GetSelectedOptionDescription() const {
@@ -123,25 +130,46 @@ public:
       SetVariable();
     }
 
-    void SetSelectedIndexByString(std::string newSetting) {
+    //Index of the option with this text, or the option count if there isn't one
+    size_t GetOptionIndex(std::string_view optionText) const {
+      //built on first use, indices of options sorted by their text. The sort is stable,
+      //so with duplicate texts the lowest index comes first, as a front to back search finds it
+      if (sortedOptionIndices.size() != options.size()) {
+        sortedOptionIndices.resize(options.size());
+        for (size_t i = 0; i < options.size(); i++) {
+          sortedOptionIndices[i] = i;
+        }
+        std::stable_sort(sortedOptionIndices.begin(), sortedOptionIndices.end(),
+                  [this](u8 lhs, u8 rhs) { return options[lhs] < options[rhs]; });
+      }
+
+      auto it = std::lower_bound(sortedOptionIndices.begin(), sortedOptionIndices.end(), optionText,
+                                 [this](u8 idx, std::string_view text) { return options[idx] < text; });
+      if (it != sortedOptionIndices.end() && options[*it] == optionText) {
+        return *it;
+      }
+      return options.size();
+    }
+
+    //Returns false if no option has this text
+    bool SetSelectedIndexByString(std::string_view newSetting) {
       using namespace Cosmetics;
 
       //Special case for custom cosmetic settings
       if (options.size() > CUSTOM_COLOR) {
         if (newSetting.substr(0, 8) == CUSTOM_COLOR_PREFIX && options[CUSTOM_COLOR].substr(0, 8) == CUSTOM_COLOR_PREFIX) {
           SetSelectedIndex(CUSTOM_COLOR);
-          SetSelectedOptionText(newSetting);
-          return;
+          SetSelectedOptionText(std::string(newSetting));
+          return true;
         }
       }
 
-      for (size_t i = 0; i < options.size(); i++) {
-        std::string settingName = options[i];
-        if (settingName == newSetting) {
-          SetSelectedIndex(i);
-          return;
-        }
+      const size_t idx = GetOptionIndex(newSetting);
+      if (idx == options.size()) {
+        return false;
       }
+      SetSelectedIndex(idx);
+      return true;
     }
 
     void Lock() {
@@ -157,11 +185,23 @@ public:
     }
 
     void Hide() {
-      hidden = true;
+      if (!hidden) {
+        hidden = true;
+        visibilityChanges++;
+      }
     }
 
     void Unhide() {
-      hidden = false;
+      if (hidden) {
+        hidden = false;
+        visibilityChanges++;
+      }
+    }
+
+    //Counts every time any option is hidden or unhidden, so menus know when to
+    //rebuild their list of visible settings
+    static u32 GetVisibilityChanges() {
+      return visibilityChanges;
     }
 
     bool IsHidden() const {
@@ -187,6 +227,8 @@ private:
   std::string name;
   std::vector<std::string> options;
   std::vector<std::string_view> optionDescriptions;
+  mutable std::vector<u8> sortedOptionIndices;
+  static inline u32 visibilityChanges = 0;
   u8 selectedOption = 0;
   bool locked = false;
   bool hidden = false;
@@ -228,13 +270,37 @@ class MenuItem {
     std::vector<MenuItem *>* itemsList;
     u8 mode;
     int selectedSetting = 0;
+
+    //Indices into settingsList of the settings that aren't hidden
+    const std::vector<u16>& GetVisibleSettings() {
+      if (visibleSettingsChanges != Option::GetVisibilityChanges() || visibleSettings.empty()) {
+        visibleSettings.clear();
+        for (size_t i = 0; i < settingsList->size(); i++) {
+          if (!settingsList->at(i)->IsHidden()) {
+            visibleSettings.push_back(i);
+          }
+        }
+        visibleSettingsChanges = Option::GetVisibilityChanges();
+      }
+      return visibleSettings;
+    }
+
+  private:
+    std::vector<u16> visibleSettings;
+    u32 visibleSettingsChanges = 0;
 };
 
 namespace Settings {
   void UpdateSettings();
+  bool ValidateSettings();
   SettingsContext FillContext();
   void SetDefaultSettings();
   void ForceChange(u32 kDown, Option* currentSetting);
+  void ResetExcludedLocationConflicts();
+  u32 GetSettingsLayoutHash();
+  std::string GetSettingsString();
+  bool SetSettingsString(std::string_view settingsString);
+  u32 GetSeedHash(std::string_view seedStr);
 
   extern std::string seed;
   extern std::string version;
@@ -254,6 +320,7 @@ namespace Settings {
   extern Option BridgeTokenCount;
   extern Option RandomGanonsTrials;
   extern Option GanonsTrialsCount;
+  extern u8 ResolvedGanonsTrialsCount;
 
   extern Option StartingAge;
   extern u8 ResolvedStartingAge;
@@ -261,6 +328,7 @@ namespace Settings {
   extern Option BombchuDrops;
   extern Option RandomMQDungeons;
   extern Option MQDungeonCount;
+  extern u8 ResolvedMQDungeonCount;
   extern Option MirrorWorld;
 
   extern Option ShuffleRewards;
@@ -4,6 +4,7 @@
 #include "item_list.hpp"
 #include "item_location.hpp"
 #include "random.hpp"
+#include "seed_arena.hpp"
 #include "settings.hpp"
 
 #include <3ds.h>
@@ -20,7 +21,7 @@ namespace {
   Handle placementlog;
 
   std::string logtxt;
-  std::string placementtxt;
+  std::pmr::string placementtxt{SeedArena_Resource()};
 
   std::array<std::string_view, 32> hashIcons = {
     "Deku Stick",
@@ -62,7 +63,7 @@ static RandomizerHash randomizerHash;
 
 void GenerateHash() {
   for (size_t i = 0; i < randomizerHash.size(); i++) {
-    const auto iconIndex = static_cast<u8>(Random(0, hashIcons.size()));
+    const auto iconIndex = static_cast<u8>(RandomFromStream(RANDOMSTREAM_HASH, 0, hashIcons.size()));
     Settings::hashIconIndexes[i] = iconIndex;
     randomizerHash[i] = hashIcons[iconIndex];
   }
@@ -183,7 +184,8 @@ static void WriteSettings() {
 
 bool SpoilerLog_Write() {
   logtxt += "Version: " + Settings::version + "\n";
-  logtxt += "Seed: " + Settings::seed + "\n\n";
+  logtxt += "Seed: " + Settings::seed + "\n";
+  logtxt += "Settings String: " + Settings::GetSettingsString() + "\n\n";
 
   logtxt += "Hash: ";
   for (std::string& str : randomizerHash) {
@@ -249,7 +251,7 @@ void PlacementLog_Msg(std::string_view msg) {
 }
 
 void PlacementLog_Clear() {
-  placementtxt = "";
+  std::pmr::string{SeedArena_Resource()}.swap(placementtxt);
 }
 
 bool PlacementLog_Write() {
@@ -0,0 +1,29 @@
+// Nothing on the host has an SD card, so every file operation fails the same way
+// it does on a 3DS without one
+
+#include <3ds.h>
+
+extern "C" {
+FS_Path fsMakePath(int, const void*) { return FS_Path{0}; }
+Result FSUSER_OpenArchive(FS_Archive*, int, FS_Path) { return -1; }
+Result FSUSER_CloseArchive(FS_Archive) { return 0; }
+Result FSUSER_CreateDirectory(FS_Archive, FS_Path, u32) { return -1; }
+Result FSUSER_DeleteFile(FS_Archive, FS_Path) { return -1; }
+Result FSUSER_OpenFile(Handle*, FS_Archive, FS_Path, u32, u32) { return -1; }
+Result FSFILE_Write(Handle, u32*, u64, const void*, u32, u32) { return -1; }
+Result FSFILE_Read(Handle, u32*, u64, void*, u32) { return -1; }
+Result FSFILE_GetSize(Handle, u64*) { return -1; }
+Result FSFILE_Close(Handle) { return 0; }
+Result romfsInit(void) { return 0; }
+PrintConsole* consoleInit(gfxScreen_t, PrintConsole* c) { return c; }
+PrintConsole* consoleSelect(PrintConsole* c) { return c; }
+void consoleClear(void) {}
+u64 svcGetSystemTick(void) { return 0; }
+void svcOutputDebugString(const char*, int) {}
+void swkbdInit(SwkbdState*, int, int, int) {}
+void swkbdSetValidation(SwkbdState*, int, int, int) {}
+void swkbdSetFeatures(SwkbdState*, int) {}
+void swkbdSetHintText(SwkbdState*, const char*) {}
+void swkbdSetButton(SwkbdState*, SwkbdButton, const char*, bool) {}
+SwkbdButton swkbdInputText(SwkbdState*, char*, size_t) { return SWKBD_BUTTON_NONE; }
+}
@@ -0,0 +1,146 @@
+// Checks the rules that keep locations included for the current settings, first
+// with stand-ins for options and locations and then with the app's own rules
+
+#include "test.hpp"
+
+#include "exclusion_rules.hpp"
+#include "item_location.hpp"
+#include "settings.hpp"
+
+struct FakeOption {
+  uint8_t index = INCLUDE;
+  bool hidden = false;
+
+  uint8_t GetSelectedOptionIndex() const {
+    return index;
+  }
+  void SetSelectedIndex(uint8_t index_) {
+    index = index_;
+  }
+  void Hide() {
+    hidden = true;
+  }
+  void Unhide() {
+    hidden = false;
+  }
+};
+
+struct FakeLocation {
+  uint16_t id;
+  FakeOption excluded = {};
+
+  uint16_t GetId() const {
+    return id;
+  }
+  FakeOption* GetExcludedOption() {
+    return &excluded;
+  }
+};
+
+using FakeRules = ExclusionRules<FakeOption, FakeLocation>;
+
+static FakeOption songs, keys;
+static FakeLocation first{0}, shared{1}, last{2};
+
+// Two rules that both cover the shared location
+static FakeRules MakeRules() {
+  songs = keys = FakeOption{};
+  first = FakeLocation{0};
+  shared = FakeLocation{1};
+  last = FakeLocation{2};
+  return FakeRules({
+    {{&songs}, []{ return songs.index == 1; }, []{ return std::vector<FakeLocation*>{&first, &shared}; }},
+    {{&keys}, []{ return keys.index == 1; }, []{ return std::vector<FakeLocation*>{&shared, &last}; }},
+  }, 3, INCLUDE);
+}
+
+static void CheckOverlap(bool songsFirst) {
+  FakeRules rules = MakeRules();
+  songs.index = keys.index = 1;
+  rules.Resolve();
+  CHECK(first.excluded.hidden && shared.excluded.hidden && last.excluded.hidden);
+  CHECK(rules.ForcedIncludeCount(first) == 1);
+  CHECK(rules.ForcedIncludeCount(shared) == 2);
+  CHECK(rules.ForcedIncludeCount(last) == 1);
+
+  // The shared location stays hidden until both rules are off, in either order
+  (songsFirst ? songs : keys).index = 0;
+  rules.Resolve();
+  CHECK(first.excluded.hidden != songsFirst);
+  CHECK(shared.excluded.hidden);
+  CHECK(last.excluded.hidden == songsFirst);
+  CHECK(rules.ForcedIncludeCount(shared) == 1);
+
+  (songsFirst ? keys : songs).index = 0;
+  rules.Resolve();
+  CHECK(!first.excluded.hidden && !shared.excluded.hidden && !last.excluded.hidden);
+  CHECK(rules.ForcedIncludeCount(first) == 0);
+  CHECK(rules.ForcedIncludeCount(shared) == 0);
+  CHECK(rules.ForcedIncludeCount(last) == 0);
+}
+
+// Resolving twice with the same settings changes nothing
+static void CheckRepeatedResolve() {
+  FakeRules rules = MakeRules();
+  songs.index = 1;
+  rules.Resolve();
+  rules.Resolve();
+  CHECK(rules.ForcedIncludeCount(shared) == 1);
+  songs.index = 0;
+  rules.Resolve();
+  CHECK(!shared.excluded.hidden);
+  CHECK(rules.ForcedIncludeCount(shared) == 0);
+}
+
+// A location excluded without going through the menu is only included again
+// once the rules are marked stale, since none of their settings changed
+static void CheckStale() {
+  FakeRules rules = MakeRules();
+  songs.index = 1;
+  rules.Resolve();
+
+  first.excluded.index = EXCLUDE;
+  rules.Resolve();
+  CHECK(first.excluded.index == EXCLUDE);
+
+  rules.MarkStale();
+  rules.Resolve();
+  CHECK(first.excluded.index == INCLUDE);
+  CHECK(first.excluded.hidden);
+  CHECK(rules.ForcedIncludeCount(first) == 1);
+}
+
+// A settings string can't exclude the Kokiri Sword Chest while the sword isn't
+// shuffled, even though loading it leaves the sword setting as it was
+static void CheckSettingsString() {
+  Option* swordChest = KF_KokiriSwordChest.GetExcludedOption();
+
+  Settings::SetDefaultSettings();
+  Settings::ShuffleKokiriSword.SetSelectedIndex(0);
+  Settings::ForceChange(0, &Settings::ShuffleKokiriSword);
+  CHECK(swordChest->IsHidden());
+
+  swordChest->SetSelectedIndex(EXCLUDE);
+  const std::string excludedString = Settings::GetSettingsString();
+  swordChest->SetSelectedIndex(INCLUDE);
+
+  CHECK(Settings::SetSettingsString(excludedString));
+  CHECK(swordChest->GetSelectedOptionIndex() == EXCLUDE);
+  Settings::ForceChange(0, &Settings::ShuffleKokiriSword);
+  CHECK(swordChest->GetSelectedOptionIndex() == INCLUDE);
+  CHECK(swordChest->IsHidden());
+
+  // Shuffling the sword lets it be excluded again
+  Settings::ShuffleKokiriSword.SetSelectedIndex(1);
+  Settings::ForceChange(0, &Settings::ShuffleKokiriSword);
+  CHECK(!swordChest->IsHidden());
+}
+
+int main(void) {
+  CheckOverlap(true);
+  CheckOverlap(false);
+  CheckRepeatedResolve();
+  CheckStale();
+  CheckSettingsString();
+  return TEST_RESULT();
+}
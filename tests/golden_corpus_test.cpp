@@ -0,0 +1,22 @@
+// Generates every seed in romfs/golden-corpus.csv and checks its digests, see
+// the Makefile for why the host generates the same seeds as the 3DS. Corpus lines
+// without digests are recorded, with their override tables next to the corpus.
+
+#include "seed_digest.hpp"
+#include "settings.hpp"
+
+#include <cstdio>
+
+int main() {
+  // generation prints its progress for the 3DS console, keep it out of the way
+  if (freopen(GOLDEN_RESULTS_PATH ".log", "w", stdout) == nullptr) {
+    return 1;
+  }
+
+  Settings::SetDefaultSettings();
+  const int mismatched = SeedDigest_CheckCorpus();
+  if (mismatched > 0) {
+    fprintf(stderr, "%d golden seeds didn't match, see " GOLDEN_RESULTS_PATH " and " GOLDEN_REPORT_PATH "\n", mismatched);
+  }
+  return mismatched == 0 ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+// The parts of libctru the app's sources use, so they build on the host for the
+// tests. The functions the tests can reach are defined in ctru_stubs.cpp.
+
+#include "3ds/types.h"
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#define SYSCLOCK_ARM11 (16756991 * 16)
+#define CPU_TICKS_PER_MSEC (SYSCLOCK_ARM11 / 1000.0)
+#define CPU_TICKS_PER_USEC (SYSCLOCK_ARM11 / 1000000.0)
+#define R_SUCCEEDED(r) ((r)>=0)
+typedef u64 FS_Archive;
+typedef struct { int t; } FS_Path;
+enum { PATH_EMPTY, PATH_ASCII };
+enum { ARCHIVE_SDMC };
+enum { FS_ATTRIBUTE_DIRECTORY=1 };
+enum { FS_OPEN_READ=1, FS_OPEN_WRITE=2, FS_OPEN_CREATE=4 };
+enum { FS_WRITE_FLUSH=1, FS_WRITE_UPDATE_TIME=2 };
+FS_Path fsMakePath(int, const void*);
+Result FSUSER_OpenArchive(FS_Archive*, int, FS_Path);
+Result FSUSER_CloseArchive(FS_Archive);
+Result FSUSER_CreateDirectory(FS_Archive, FS_Path, u32);
+Result FSUSER_DeleteFile(FS_Archive, FS_Path);
+Result FSUSER_OpenFile(Handle*, FS_Archive, FS_Path, u32, u32);
+Result FSFILE_Write(Handle, u32*, u64, const void*, u32, u32);
+Result FSFILE_Read(Handle, u32*, u64, void*, u32);
+Result FSFILE_GetSize(Handle, u64*);
+Result FSFILE_Close(Handle);
+Result FSUSER_OpenDirectory(Handle*, FS_Archive, FS_Path);
+typedef struct { int x; } PrintConsole;
+enum gfxScreen_t { GFX_TOP, GFX_BOTTOM };
+PrintConsole* consoleInit(gfxScreen_t, PrintConsole*);
+PrintConsole* consoleSelect(PrintConsole*);
+void consoleClear(void);
+u64 svcGetSystemTick(void);
+void svcOutputDebugString(const char*, int);
+enum { KEY_A=1, KEY_B=2, KEY_SELECT=4, KEY_START=8, KEY_DRIGHT=16, KEY_DLEFT=32, KEY_DUP=64, KEY_DDOWN=128, KEY_R=256, KEY_L=512, KEY_X=1024, KEY_Y=2048 };
+typedef struct { int x; } SwkbdState;
+typedef enum { SWKBD_BUTTON_LEFT, SWKBD_BUTTON_NONE } SwkbdButton;
+enum { SWKBD_TYPE_WESTERN, SWKBD_NOTEMPTY_NOTBLANK, SWKBD_FILTER_AT=1, SWKBD_FILTER_PERCENT=2, SWKBD_FILTER_BACKSLASH=4, SWKBD_FILTER_PROFANITY=8, SWKBD_MULTILINE=1 };
+void swkbdInit(SwkbdState*, int, int, int);
+void swkbdSetValidation(SwkbdState*, int, int, int);
+void swkbdSetFeatures(SwkbdState*, int);
+void swkbdSetHintText(SwkbdState*, const char*);
+void swkbdSetButton(SwkbdState*, SwkbdButton, const char*, bool);
+SwkbdButton swkbdInputText(SwkbdState*, char*, size_t);
+Result romfsInit(void);
+void gfxInitDefault(void); void gfxExit(void); void gfxFlushBuffers(void); void gfxSwapBuffers(void); void gspWaitForVBlank(void);
+void hidScanInput(void); u32 hidKeysDown(void); u32 hidKeysHeld(void);
+bool aptMainLoop(void); void aptSetChainloader(u64, u8);
+#ifdef __cplusplus
+}
+#endif
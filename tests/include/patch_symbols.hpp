@@ -0,0 +1,11 @@
+#pragma once
+
+// code/patch.py writes this file from the patch build with the addresses the
+// app patches. The host tests only need them to be distinct.
+#define RITEMOVERRIDES_ADDR 0x00100000
+#define GSETTINGSCONTEXT_ADDR 0x00200000
+#define RSCRUBRANDOMITEMPRICES_ADDR 0x00300000
+#define RDUNGEONREWARDOVERRIDES_ADDR 0x00400000
+#define RCUSTOMMESSAGES_ADDR 0x00500000
+#define NUMCUSTOMMESSAGEENTRIES_ADDR 0x00600000
+#define PTRCUSTOMMESSAGEENTRIES_ADDR 0x00700000
@@ -0,0 +1,82 @@
+// Checks that every item the app places has a row in the patch's item table,
+// read from the same list code/src/item_table.c is built from
+
+#include "test.hpp"
+
+#include "item_list.hpp"
+#include "item_location.hpp"
+#include "playthrough.hpp"
+#include "settings.hpp"
+#include "../code/src/item_override.h"
+
+#include <bitset>
+
+static constexpr u8 itemTableRowIds[] = {
+#define ITEM_ROW(getItemId_, ...) getItemId_,
+#include "../code/src/item_table_rows.h"
+#undef ITEM_ROW
+};
+
+static std::bitset<256> hasRow;
+
+static void CheckPlacedItems(const char* settingsName) {
+  for (ItemLocation* loc : allLocations) {
+    const Item& item = loc->GetPlacedItem();
+    //Shop items use shop ids, which index the shop table instead
+    if (item.GetItemType() == ITEMTYPE_SHOP) {
+      continue;
+    }
+
+    const int id = item.GetItemID();
+    const bool itemHasRow = id > 0 && id < static_cast<int>(hasRow.size()) && hasRow[id];
+    if (!itemHasRow) {
+      fprintf(stderr, "%s: %s at %s has no item table row (0x%02X)\n", settingsName, item.GetName().data(), loc->GetName().data(), id);
+    }
+    CHECK(itemHasRow);
+
+    //Ice traps look like another item, which needs a row too
+    const u16 looksLikeId = item.Value().looksLikeItemId;
+    CHECK(looksLikeId == 0 || hasRow[looksLikeId]);
+  }
+}
+
+static void GenerateAndCheck(const char* settingsName) {
+  for (u32 seed = 1; seed <= 3; ++seed) {
+    CHECK(Playthrough::Playthrough_Init(seed) == 1);
+    CheckPlacedItems(settingsName);
+  }
+}
+
+int main(void) {
+  for (const u8 id : itemTableRowIds) {
+    hasRow[id] = true;
+  }
+
+  // generation prints its progress for the 3DS console, keep it out of the way
+  if (freopen("build/item_table_rows_test.log", "w", stdout) == nullptr) {
+    return 1;
+  }
+
+  Settings::SetDefaultSettings();
+  GenerateAndCheck("default settings");
+
+  // Shuffle everything that can be shuffled, so every kind of item gets placed
+  Settings::Shopsanity.SetSelectedIndex(SHOPSANITY_FOUR);
+  Settings::Tokensanity.SetSelectedIndex(TOKENSANITY_ALL_TOKENS);
+  Settings::Scrubsanity.SetSelectedIndex(SCRUBSANITY_AFFORDABLE);
+  Settings::ShuffleCows.SetSelectedIndex(1);
+  Settings::ShuffleKokiriSword.SetSelectedIndex(1);
+  Settings::ShuffleOcarinas.SetSelectedIndex(1);
+  Settings::ShuffleWeirdEgg.SetSelectedIndex(1);
+  Settings::ShuffleGerudoToken.SetSelectedIndex(1);
+  Settings::ShuffleMagicBeans.SetSelectedIndex(1);
+  Settings::ShuffleSongs.SetSelectedIndex(SONGSHUFFLE_ANYWHERE);
+  Settings::MapsAndCompasses.SetSelectedIndex(MAPSANDCOMPASSES_ANYWHERE);
+  Settings::Keysanity.SetSelectedIndex(KEYSANITY_ANYWHERE);
+  Settings::GerudoKeys.SetSelectedIndex(GERUDOKEYS_ANYWHERE);
+  Settings::BossKeysanity.SetSelectedIndex(BOSSKEYSANITY_ANYWHERE);
+  Settings::IceTrapValue.SetSelectedIndex(ICETRAPS_ONSLAUGHT);
+  GenerateAndCheck("everything shuffled");
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdio>
+
+static int testFailures = 0;
+
+static void Test_Fail(const char* file, int line, const char* condition) {
+  fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, condition);
+  testFailures++;
+}
+
+// Reports a failed condition and keeps going, so one run lists every failure
+#define CHECK(condition)                           \
+  do {                                             \
+    if (!(condition)) {                            \
+      Test_Fail(__FILE__, __LINE__, #condition);   \
+    }                                              \
+  } while (0)
+
+#define TEST_RESULT() (testFailures == 0 ? 0 : 1)